@@ -0,0 +1,680 @@
+/*
+ * bench_inicpp.cpp
+ *
+ * Created on: 19 Oct 2026
+ *    License: MIT
+ *
+ * Benchmarks of en- and decoding, lookups and conversions
+ * on synthetic ini-files created by IniGenerator.
+ * Allocations are counted by allocCounter.cpp linked in.
+ * Like the tests this is built once for each combination
+ * of SSTREAM_PREVENTED and THROW_PREVENTED,
+ * but as separate executables
+ * because these switches change the header itself.
+ *
+ * Usage: bench_inicpp_<variant> [--sections N] [--fields N]
+ *   [--key-length N] [--value-length N] [--comments P] [--crlf]
+ *   [--seed N] [--files N] [--threads N] [--min-time SECONDS]
+ *   [--filter SUBSTRING]
+ */
+
+#include "inicpp.h"
+#include "iniGenerator.h"
+#include "../test/allocCounter.h"
+
+#include <chrono>
+#include <filesystem>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifndef SSTREAM_PREVENTED
+#include <sstream>
+#endif
+
+#ifdef SSTREAM_PREVENTED
+#define SS "SSY"
+#else
+#define SS "SSN"
+#endif
+
+#ifdef THROW_PREVENTED
+#define TH "THY"
+#else
+#define TH "THN"
+#endif
+
+namespace
+{
+    class BenchConfig
+    {
+    public:
+        ini::bench::GeneratorConfig gen;
+        // number of small files loaded by IniFile::loadAll
+        unsigned int numFiles = 512;
+        // maximal number of threads of IniFile::loadAll;
+        // if 0, the number of hardware threads
+        unsigned int maxThreads = 0;
+        // minimal time in seconds each benchmark runs
+        double minTime = 0.2;
+        // if not empty, only benchmarks with names containing this run
+        std::string filter;
+    }; // class BenchConfig
+
+    // results are accumulated here so that they are not optimized away
+    volatile std::size_t sink = 0;
+
+    /**
+     * Runs \p op repeatedly for at least BenchConfig#minTime seconds
+     * and prints the time and the allocations per operation
+     * and if \p bytesPerCall is not 0 also the throughput.
+     *
+     * @param opsPerCall
+     *    the number of operations performed by one invocation of \p op.
+     * @param bytesPerCall
+     *    the number of bytes processed by one invocation of \p op.
+     */
+    template<class Op>
+    void run(const BenchConfig &config,
+             const char *name,
+             std::size_t opsPerCall,
+             std::size_t bytesPerCall,
+             Op op)
+    {
+        if (!config.filter.empty() && strstr(name, config.filter.c_str()) == NULL)
+            return;
+        typedef std::chrono::steady_clock Clock;
+        // warm up caches and allocator
+        op();
+        std::size_t numCalls = 0;
+        std::size_t batch = 1;
+        double elapsed;
+        std::size_t numAllocsStart = ini::test::numAllocations();
+        Clock::time_point start = Clock::now();
+        do
+        {
+            for (std::size_t idx = 0; idx < batch; idx++)
+                op();
+            numCalls += batch;
+            batch *= 2;
+            elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+        } while (elapsed < config.minTime);
+        std::size_t numAllocs = ini::test::numAllocations() - numAllocsStart;
+
+        printf("%s %s %-26s %12.1f ns/op %10.2f allocs/op", TH, SS, name,
+               elapsed * 1e9 / ((double)numCalls * opsPerCall),
+               (double)numAllocs / ((double)numCalls * opsPerCall));
+        if (bytesPerCall != 0)
+            printf(" %10.1f MB/s", (double)numCalls * bytesPerCall / elapsed / 1e6);
+        printf("\n");
+    }
+
+#ifdef SSTREAM_PREVENTED
+    void skip(const BenchConfig &config, const char *name, const char *reason)
+    {
+        if (!config.filter.empty() && strstr(name, config.filter.c_str()) == NULL)
+            return;
+        printf("%s %s %-26s skipped: %s\n", TH, SS, name, reason);
+    }
+#endif
+
+#ifdef THROW_PREVENTED
+    void checkOk(ini::IniFile::DecEncResult res, const char *what)
+    {
+        if (!res.isOk())
+        {
+            fprintf(stderr, "%s failed with code %d in line %d\n",
+                    what, (int)res.getErrorCode(), res.getLineNumber());
+            exit(1);
+        }
+    }
+#endif
+
+    void decodeString(ini::IniFile &inif, const std::string &content)
+    {
+#ifdef THROW_PREVENTED
+        checkOk(inif.tryDecode(content), "decoding string");
+#else
+        inif.decode(content);
+#endif
+    }
+
+    void decodeFile(ini::IniFile &inif, const std::string &fileName)
+    {
+#ifdef THROW_PREVENTED
+        checkOk(inif.tryLoad(fileName), "loading file");
+#else
+        inif.load(fileName);
+#endif
+    }
+
+    void encodeString(ini::IniFile &inif, std::string &content)
+    {
+#ifdef THROW_PREVENTED
+        checkOk(inif.tryEncode(content), "encoding string");
+#else
+        content = inif.encode();
+#endif
+    }
+
+    /**
+     * Collects the names of the sections and the keys in \p content
+     * as generated by IniGenerator, i.e. without any failures.
+     */
+    void collectNames(const std::string &content,
+                      std::vector<std::pair<std::string, std::string>> &names)
+    {
+        std::string section;
+        std::size_t pos = 0;
+        while (pos < content.size())
+        {
+            std::size_t end = content.find('\n', pos);
+            std::string line = content.substr(pos, end - pos);
+            pos = end + 1;
+            if (!line.empty() && line[line.size() - 1] == '\r')
+                line.erase(line.size() - 1);
+            if (line.empty() || line[0] == '#')
+                continue;
+            if (line[0] == '[')
+                section = line.substr(1, line.size() - 2);
+            else
+                names.push_back(std::make_pair(section,
+                                               line.substr(0, line.find('='))));
+        }
+    }
+
+    /**
+     * Benchmarks converting each field of \p fields into \p T.
+     */
+    template<class T>
+    void runAs(const BenchConfig &config,
+               const char *name,
+               const std::vector<ini::IniField *> &fields)
+    {
+        run(config, name, fields.size(), 0, [&fields]()
+            {
+                for (ini::IniField *field : fields)
+                {
+#ifdef THROW_PREVENTED
+                    T value = field->orDefault(T());
+#else
+                    T value = field->as<T>();
+#endif
+                    sink = sink + (std::size_t)(bool)(value == T());
+                }
+            });
+    }
+
+    /**
+     * Returns the fields of section "conv" in \p inif
+     * after assigning \p values to them as text,
+     * so that converting parses like after decoding.
+     */
+    template<class T>
+    std::vector<ini::IniField *> convFields(ini::IniFile &inif,
+                                            const std::vector<T> &values)
+    {
+        inif["conv"].map.clear();
+        for (std::size_t idx = 0; idx < values.size(); idx++)
+        {
+            ini::IniField &field = inif["conv"]["f" + std::to_string(idx)];
+            field = values[idx];
+            field = std::string(field.toString());
+        }
+        std::vector<ini::IniField *> fields;
+        for (std::size_t idx = 0; idx < values.size(); idx++)
+            fields.push_back(&inif["conv"]["f" + std::to_string(idx)]);
+        return fields;
+    }
+
+    void runConversions(const BenchConfig &config)
+    {
+        const std::size_t num = 256;
+        std::vector<unsigned int> mult = {(unsigned int)num};
+        ini::IniFile inif(mult);
+        std::vector<std::string> strs;
+        std::vector<long int> longs;
+        std::vector<unsigned long int> ulongs;
+        std::vector<int> ints;
+        std::vector<unsigned int> uints;
+        std::vector<double> doubles;
+        std::vector<float> floats;
+        std::vector<bool> bools;
+        ini::bench::GeneratorConfig genConfig = config.gen;
+        genConfig.numSections = 1;
+        genConfig.fieldsPerSection = num;
+        genConfig.commentDensity = 0.0;
+        std::string content = ini::bench::IniGenerator(genConfig).generate();
+        std::vector<std::pair<std::string, std::string>> names;
+        collectNames(content, names);
+        for (std::size_t idx = 0; idx < num; idx++)
+        {
+            long int val = (long int)(idx * 2654435761u % 2000001u) - 1000000;
+            strs.push_back(names[idx].second);
+            longs.push_back(val * 1000003);
+            ulongs.push_back((unsigned long int)(val + 1000000) * 1000003u);
+            ints.push_back((int)val);
+            uints.push_back((unsigned int)(val + 1000000));
+            doubles.push_back(val / 1024.0);
+            floats.push_back((float)(val / 64.0));
+            bools.push_back(idx % 2 == 0);
+        }
+
+        std::vector<ini::IniField *> fields = convFields(inif, strs);
+        runAs<const char *>(config, "as<const char*>", fields);
+        runAs<std::string>(config, "as<std::string>", fields);
+        fields = convFields(inif, ints);
+        runAs<int>(config, "as<int>", fields);
+        run(config, "operator=(int), as<int>", fields.size(), 0, [&]()
+            {
+                for (ini::IniField *field : fields)
+                    *field = field->orDefault(0) + 1;
+            });
+        fields = convFields(inif, uints);
+        runAs<unsigned int>(config, "as<unsigned int>", fields);
+        fields = convFields(inif, longs);
+        runAs<long int>(config, "as<long int>", fields);
+        fields = convFields(inif, ulongs);
+        runAs<unsigned long int>(config, "as<unsigned long int>", fields);
+        fields = convFields(inif, doubles);
+        runAs<double>(config, "as<double>", fields);
+        fields = convFields(inif, floats);
+        runAs<float>(config, "as<float>", fields);
+        std::vector<ini::IniField *> boolFields;
+        inif["conv"].map.clear();
+        for (std::size_t idx = 0; idx < num; idx++)
+            inif["conv"]["f" + std::to_string(idx)] =
+                std::string(bools[idx] ? "true" : "false");
+        for (std::size_t idx = 0; idx < num; idx++)
+            boolFields.push_back(&inif["conv"]["f" + std::to_string(idx)]);
+        runAs<bool>(config, "as<bool>", boolFields);
+
+        // a single field with a long list of numbers
+        std::string list;
+        for (std::size_t idx = 0; idx < 100000; idx++)
+            list += (idx == 0 ? "" : ",") + std::to_string(ints[idx % num]);
+        ini::IniField &listField = inif["conv"]["list"];
+        listField = list;
+        run(config, "forEachElement<int> 100k", 1, list.size(), [&]()
+            {
+                long int sum = 0;
+                listField.forEachElement<int>(',', [&sum](int elem)
+                                              {
+                                                  sum += elem;
+                                              });
+                sink = sink + (std::size_t)sum;
+            });
+        run(config, "tryAsVector<int> 100k", 1, list.size(), [&]()
+            {
+                std::vector<int> values;
+                listField.tryAsVector(values);
+                sink = sink + values.size();
+            });
+    }
+
+    /**
+     * Benchmarks en- and decoding a blob of 4 MiB as hex and as base64.
+     */
+    void runBlobs(const BenchConfig &config)
+    {
+        std::vector<std::uint8_t> bytes(4 << 20);
+        std::uint32_t state = config.gen.seed == 0 ? 1 : config.gen.seed;
+        for (std::uint8_t &byte : bytes)
+        {
+            state ^= state << 13;
+            state ^= state >> 17;
+            state ^= state << 5;
+            byte = (std::uint8_t)state;
+        }
+        ini::IniField field;
+        std::vector<std::uint8_t> decoded;
+        field.assignBytes(bytes.data(), bytes.size(), ini::BLOB_HEX);
+        run(config, "assignBytes hex 4M", 1, bytes.size(), [&]()
+            {
+                field.assignBytes(bytes.data(), bytes.size(), ini::BLOB_HEX);
+                sink = sink + field.toString().size();
+            });
+        run(config, "tryAsBytes hex 4M", 1, bytes.size(), [&]()
+            {
+                sink = sink + field.tryAsBytes(decoded, ini::BLOB_HEX);
+            });
+        field.assignBytes(bytes.data(), bytes.size(), ini::BLOB_BASE64);
+        run(config, "assignBytes base64 4M", 1, bytes.size(), [&]()
+            {
+                field.assignBytes(bytes.data(), bytes.size(), ini::BLOB_BASE64);
+                sink = sink + field.toString().size();
+            });
+        run(config, "tryAsBytes base64 4M", 1, bytes.size(), [&]()
+            {
+                sink = sink + field.tryAsBytes(decoded, ini::BLOB_BASE64);
+            });
+    }
+
+    /**
+     * Benchmarks loading a file with two values of 16 MiB each
+     * copying all values and keeping large values in the file mapped,
+     * see IniFile::setLargeValueThreshold.
+     */
+    void runLargeValues(const BenchConfig &config)
+    {
+        if (!config.filter.empty()
+            && strstr("tryLoad large", config.filter.c_str()) == NULL)
+            return;
+        std::string fileName = (std::filesystem::temp_directory_path()
+                                / ("bench_inicpp_large_" TH "_" SS ".ini")).string();
+        std::string value(16 << 20, 'x');
+        std::string content = "[A]\nsmall=1\nlarge=" + value
+            + "\n[B]\nlarge=" + value + "\n";
+        FILE *file = fopen(fileName.c_str(), "wb");
+        if (file == NULL || fwrite(content.data(), 1, content.size(), file)
+            != content.size() || fclose(file) != 0)
+        {
+            fprintf(stderr, "could not write %s\n", fileName.c_str());
+            exit(1);
+        }
+        std::vector<unsigned int> mult = {2u, 1u};
+        ini::IniFile inif(mult);
+        run(config, "tryLoad large copied", 1, content.size(), [&]()
+            {
+                sink = sink + inif.tryLoad(fileName).isOk();
+            });
+        inif.setLargeValueThreshold(4096);
+        run(config, "tryLoad large mapped", 1, content.size(), [&]()
+            {
+                sink = sink + inif.tryLoad(fileName).isOk();
+            });
+        std::filesystem::remove(fileName);
+    }
+
+    /**
+     * Benchmarks IniFile::saveAll on BenchConfig#numFiles small files
+     * and IniFile::loadAll with 1, 2, 4 ... threads
+     * up to BenchConfig#maxThreads.
+     */
+    void runLoadAll(const BenchConfig &config)
+    {
+        if (!config.filter.empty()
+            && strstr("loadAll", config.filter.c_str()) == NULL
+            && strstr("saveAll", config.filter.c_str()) == NULL)
+            return;
+        ini::bench::GeneratorConfig genConfig = config.gen;
+        genConfig.numSections = 4;
+        genConfig.fieldsPerSection = 8;
+        std::vector<std::string> fileNames;
+        std::size_t numBytes = 0;
+        std::filesystem::path dir = std::filesystem::temp_directory_path()
+            / ("bench_inicpp_" TH "_" SS ".d");
+        std::filesystem::create_directories(dir);
+        for (unsigned int idx = 0; idx < config.numFiles; idx++)
+        {
+            genConfig.seed = config.gen.seed + idx;
+            std::string content = ini::bench::IniGenerator(genConfig).generate();
+            std::string fileName =
+                (dir / ("file" + std::to_string(idx) + ".ini")).string();
+            FILE *file = fopen(fileName.c_str(), "wb");
+            if (file == NULL || fwrite(content.data(), 1, content.size(), file)
+                != content.size() || fclose(file) != 0)
+            {
+                fprintf(stderr, "could not write %s\n", fileName.c_str());
+                exit(1);
+            }
+            fileNames.push_back(fileName);
+            numBytes += content.size();
+        }
+        const std::vector<unsigned int> mult =
+            ini::bench::IniGenerator(genConfig).lenSections();
+
+        std::vector<ini::IniFile> iniFiles(fileNames.size(), ini::IniFile(mult));
+        ini::IniFile::loadAll(iniFiles, fileNames);
+        run(config, "saveAll", fileNames.size(), numBytes, [&]()
+            {
+                std::vector<ini::IniFile::DecEncResult> results =
+                    ini::IniFile::saveAll(iniFiles, fileNames);
+                sink = sink + results.size();
+            });
+
+        unsigned int maxThreads = config.maxThreads != 0 ? config.maxThreads
+            : std::max(1u, std::thread::hardware_concurrency());
+        for (unsigned int numThreads = 1; ; numThreads *= 2)
+        {
+            numThreads = std::min(numThreads, maxThreads);
+            std::string name = "loadAll(threads=" + std::to_string(numThreads) + ")";
+            run(config, name.c_str(), fileNames.size(), numBytes, [&]()
+                {
+                    std::vector<ini::IniFile> iniFiles(fileNames.size(),
+                                                       ini::IniFile(mult));
+                    std::vector<ini::IniFile::DecEncResult> results =
+                        ini::IniFile::loadAll(iniFiles, fileNames, numThreads);
+                    for (ini::IniFile::DecEncResult &res : results)
+                    {
+                        if (!res.isOk())
+                        {
+                            fprintf(stderr, "loadAll failed with code %d\n",
+                                    (int)res.getErrorCode());
+                            exit(1);
+                        }
+                    }
+                    sink = sink + results.size();
+                });
+            if (numThreads == maxThreads)
+                break;
+        }
+        std::filesystem::remove_all(dir);
+    }
+
+    bool parseArgs(int argc, char **argv, BenchConfig &config)
+    {
+        for (int idx = 1; idx < argc; idx++)
+        {
+            std::string arg = argv[idx];
+            if (arg == "--crlf")
+            {
+                config.gen.crlf = true;
+                continue;
+            }
+            if (idx + 1 == argc)
+                return false;
+            const char *val = argv[++idx];
+            if (arg == "--sections")
+                config.gen.numSections = (unsigned int)strtoul(val, NULL, 10);
+            else if (arg == "--fields")
+                config.gen.fieldsPerSection = (unsigned int)strtoul(val, NULL, 10);
+            else if (arg == "--key-length")
+                config.gen.keyLength = (unsigned int)strtoul(val, NULL, 10);
+            else if (arg == "--value-length")
+                config.gen.valueLength = (unsigned int)strtoul(val, NULL, 10);
+            else if (arg == "--comments")
+                config.gen.commentDensity = strtod(val, NULL);
+            else if (arg == "--seed")
+                config.gen.seed = (std::uint32_t)strtoul(val, NULL, 10);
+            else if (arg == "--files")
+                config.numFiles = (unsigned int)strtoul(val, NULL, 10);
+            else if (arg == "--threads")
+                config.maxThreads = (unsigned int)strtoul(val, NULL, 10);
+            else if (arg == "--min-time")
+                config.minTime = strtod(val, NULL);
+            else if (arg == "--filter")
+                config.filter = val;
+            else
+                return false;
+        }
+        return true;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    BenchConfig config;
+    if (!parseArgs(argc, argv, config))
+    {
+        fprintf(stderr,
+                "usage: %s [--sections N] [--fields N] [--key-length N]"
+                " [--value-length N] [--comments P] [--crlf] [--seed N]"
+                " [--files N] [--threads N] [--min-time SECONDS]"
+                " [--filter SUBSTRING]\n",
+                argv[0]);
+        return 2;
+    }
+
+    ini::bench::IniGenerator generator(config.gen);
+    const std::string content = generator.generate();
+    const std::vector<unsigned int> mult = generator.lenSections();
+    const std::size_t numFields =
+        (std::size_t)config.gen.numSections * config.gen.fieldsPerSection;
+    printf("%s %s %u sections, %u fields each, %zu bytes\n", TH, SS,
+           config.gen.numSections, config.gen.fieldsPerSection, content.size());
+
+    run(config, "tryDecode(string)", 1, content.size(), [&]()
+        {
+            ini::IniFile inif(mult);
+            decodeString(inif, content);
+            sink = sink + inif.size();
+        });
+
+    // the same grammar but fixed at compile time 
+    run(config, "tryDecode(string) static", 1, content.size(), [&]()
+        {
+            ini::t_IniFile<ini::t_StaticDialect<'=', '#'> > inif(mult);
+            if (!inif.tryDecode(content).isOk())
+            {
+                fprintf(stderr, "decoding string failed\n");
+                exit(1);
+            }
+            sink = sink + inif.size();
+        });
+
+#ifdef SSTREAM_PREVENTED
+    skip(config, "tryDecode(stream)", "streams prevented");
+#else
+    run(config, "tryDecode(stream)", 1, content.size(), [&]()
+        {
+            ini::IniFile inif(mult);
+            std::istringstream iss(content);
+#ifdef THROW_PREVENTED
+            checkOk(inif.tryDecode(iss), "decoding stream");
+#else
+            inif.decode(iss);
+#endif
+            sink = sink + inif.size();
+        });
+#endif
+
+    const std::string fileName = (std::filesystem::temp_directory_path()
+                                  / ("bench_inicpp_" TH "_" SS ".ini")).string();
+    FILE *file = fopen(fileName.c_str(), "wb");
+    if (file == NULL || fwrite(content.data(), 1, content.size(), file)
+        != content.size() || fclose(file) != 0)
+    {
+        fprintf(stderr, "could not write %s\n", fileName.c_str());
+        return 1;
+    }
+    run(config, "tryLoad(file)", 1, content.size(), [&]()
+        {
+            ini::IniFile inif(mult);
+            decodeFile(inif, fileName);
+            sink = sink + inif.size();
+        });
+    // as processes using a few sections of a large file
+    std::vector<std::string> touched;
+    for (std::size_t pos = content.find('['); pos != std::string::npos;
+         pos = content.find("\n[", pos + 1))
+    {
+        std::size_t begin = content[pos] == '[' ? pos + 1 : pos + 2;
+        std::string secName = content.substr(begin, content.find(']', begin) - begin);
+        if (touched.size() < 5)
+            touched.push_back(secName);
+        else
+            touched[(begin * 7) % 5] = secName;
+    }
+    run(config, "tryLoad(file) lazy, 5 sec", 1, content.size(), [&]()
+        {
+            ini::IniFile inif(mult);
+            inif.setLazy(true);
+            decodeFile(inif, fileName);
+            for (const std::string &secName : touched)
+                sink = sink + inif[secName].size();
+        });
+    run(config, "tryLoad(file) filter, 2 sec", 1, content.size(), [&]()
+        {
+            ini::IniFile inif(mult);
+            ini::SectionFilter filter({touched[0], touched[1 % touched.size()]});
+#ifdef THROW_PREVENTED
+            checkOk(inif.tryLoad(fileName, filter), "loading file");
+#else
+            inif.load(fileName, filter);
+#endif
+            sink = sink + inif.size();
+        });
+    remove(fileName.c_str());
+
+    ini::IniFile inif(mult);
+    decodeString(inif, content);
+
+    std::string encoded;
+    encodeString(inif, encoded);
+    run(config, "tryEncode(string)", 1, encoded.size(), [&]()
+        {
+            encodeString(inif, encoded);
+            sink = sink + encoded.size();
+        });
+
+    // like tryEncode without building an IniFile 
+    const std::string value(config.gen.valueLength, 'v');
+    run(config, "IniWriter(string)", 1, encoded.size(), [&]()
+        {
+            std::string written;
+            ini::IniFile::OutStringBuffer buffer(written, 0);
+            ini::IniWriter writer(buffer);
+            std::string name;
+            for (unsigned int sec = 0; sec < config.gen.numSections; sec++)
+            {
+                name = "s" + std::to_string(sec);
+                writer.beginSection(name);
+                for (unsigned int fld = 0; fld < config.gen.fieldsPerSection; fld++)
+                {
+                    name = "k" + std::to_string(fld);
+                    writer.field(name, value);
+                }
+            }
+            writer.finish();
+            sink = sink + written.size();
+        });
+
+    std::vector<std::pair<std::string, std::string>> names;
+    collectNames(content, names);
+    // visit the fields in a random but fixed order
+    std::uint32_t state = config.gen.seed == 0 ? 1 : config.gen.seed;
+    for (std::size_t idx = names.size(); idx > 1; idx--)
+    {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        std::swap(names[idx - 1], names[state % idx]);
+    }
+    if (numFields != 0)
+    {
+        run(config, "operator[]", names.size(), 0, [&]()
+            {
+                for (const std::pair<std::string, std::string> &name : names)
+                    sink = sink + inif[name.first][name.second].toString().size();
+            });
+
+        std::vector<ini::FieldHandle> handles;
+        for (const std::pair<std::string, std::string> &name : names)
+            handles.push_back(inif.resolve(name.first, name.second));
+        run(config, "tryAt(handle)", handles.size(), 0, [&]()
+            {
+                for (const ini::FieldHandle &handle : handles)
+                    sink = sink + inif.tryAt(handle)->toString().size();
+            });
+    }
+
+    runConversions(config);
+    runBlobs(config);
+    runLargeValues(config);
+    runLoadAll(config);
+    return 0;
+}
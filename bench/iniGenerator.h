@@ -0,0 +1,144 @@
+/*
+ * iniGenerator.h
+ *
+ * Created on: 19 Oct 2026
+ *    License: MIT
+ */
+
+#ifndef INI_GENERATOR_H_
+#define INI_GENERATOR_H_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace ini
+{
+namespace bench
+{
+    /**
+     * Parameters of a synthetic ini-file created by IniGenerator.
+     * Equal parameters yield equal files.
+     */
+    class GeneratorConfig
+    {
+    public:
+        unsigned int numSections = 100;
+        unsigned int fieldsPerSection = 20;
+        // lengths of section names and keys
+        unsigned int keyLength = 12;
+        unsigned int valueLength = 24;
+        // probability in [0,1] that a comment line precedes a line
+        double commentDensity = 0.1;
+        // whether lines end with \r\n instead of \n
+        bool crlf = false;
+        std::uint32_t seed = 42;
+    }; // class GeneratorConfig
+
+    /**
+     * Creates synthetic ini-files deterministically,
+     * i.e. using a pseudo random generator of its own seeded by
+     * GeneratorConfig#seed.
+     * Sections and keys within a section are unique by construction.
+     */
+    class IniGenerator
+    {
+    private:
+        GeneratorConfig config_;
+        std::uint32_t state_;
+
+        // xorshift32
+        std::uint32_t next()
+        {
+            state_ ^= state_ << 13;
+            state_ ^= state_ >> 17;
+            state_ ^= state_ << 5;
+            return state_;
+        }
+
+        char nextAlnum()
+        {
+            static const char CHARS[] =
+                "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789";
+            return CHARS[next() % (sizeof(CHARS) - 1)];
+        }
+
+        /**
+	 * Returns \p prefix followed by \p idx
+	 * padded with random characters up to \p length.
+	 * The number makes the name unique.
+	 */
+        std::string name(char prefix, unsigned int idx, unsigned int length)
+        {
+            std::string res(1, prefix);
+            res += std::to_string(idx);
+            res += '_';
+            while (res.size() < length)
+                res += nextAlnum();
+            return res;
+        }
+
+        void appendNl(std::string &str) const
+        {
+            if (config_.crlf)
+                str += '\r';
+            str += '\n';
+        }
+
+        void maybeComment(std::string &str)
+        {
+            if (next() < config_.commentDensity * 4294967295.0)
+            {
+                str += "# ";
+                for (unsigned int idx = 0; idx < config_.valueLength; idx++)
+                    str += nextAlnum();
+                appendNl(str);
+            }
+        }
+
+    public:
+        IniGenerator(const GeneratorConfig &config)
+          : config_(config), state_(config.seed == 0 ? 1 : config.seed)
+        {}
+
+        /**
+	 * Returns the text of the ini-file.
+	 */
+        std::string generate()
+        {
+            state_ = config_.seed == 0 ? 1 : config_.seed;
+            std::string res;
+            for (unsigned int sec = 0; sec < config_.numSections; sec++)
+            {
+                maybeComment(res);
+                res += '[';
+                res += name('s', sec, config_.keyLength);
+                res += ']';
+                appendNl(res);
+                for (unsigned int fld = 0; fld < config_.fieldsPerSection; fld++)
+                {
+                    maybeComment(res);
+                    res += name('k', fld, config_.keyLength);
+                    res += '=';
+                    for (unsigned int idx = 0; idx < config_.valueLength; idx++)
+                        res += nextAlnum();
+                    appendNl(res);
+                }
+            }
+            return res;
+        }
+
+        /**
+	 * Returns the number of fields per section
+	 * as required by the constructors of IniFile.
+	 */
+        std::vector<unsigned int> lenSections() const
+        {
+            return std::vector<unsigned int>(config_.numSections,
+                                             config_.fieldsPerSection);
+        }
+    }; // class IniGenerator
+}
+}
+
+#endif
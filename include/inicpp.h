@@ -20,52 +20,687 @@
 
 
 #include <vector>
-//#include <array>
+#include <array>
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <list>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
 
 #include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
+#include <sys/stat.h>
 
-// maybe alternative to iostream
-//#include <stdio.h>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#ifndef THREADS_PREVENTED
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
+
+#ifdef DEC_ENC_STATISTICS_ENABLED
+#include <chrono>
+#endif
 
+#ifdef IO_URING_ENABLED
+#include <errno.h>
+#include <fcntl.h>
+#include <linux/io_uring.h>
+#include <linux/stat.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
 
 // CAUTION: for embedded systems in general it is recommended
 // to set following switches:
 // - THROW_PREVENTED disallows methods (and constructors) throwing exceptions
 // - SSTREAM_PREVENTED activates implementations not using streams
 //   TBD: clarify consequences: above all lengths 
+// - THREADS_PREVENTED disables locking of data shared between threads, 
+//   e.g. the cache of included files; 
+//   then decoding must not run in more than one thread at a time. 
+// Independent of that:
+// - DEC_ENC_STATISTICS_ENABLED makes decoding and encoding
+//   record statistics and timings, see DecEncStatistics. 
+// - IO_URING_ENABLED, on linux only, makes IniFile::loadAll 
+//   and IniFile::saveAll read and write files via io_uring, 
+//   falling back to streams if the kernel does not provide it. 
+// - SIMD_PREVENTED disables the SIMD kernels en- and decoding blobs, 
+//   see BlobCodec; else they are used on x86-64 with gcc or clang. 
+
+// Vector instructions for BlobCodec: SSE2 is part of x86-64, 
+// SSSE3 is not and is compiled per function and detected at runtime. 
+#if !defined(SIMD_PREVENTED) && defined(__x86_64__) && defined(__GNUC__)
+#define INI_SIMD_X86
+#include <immintrin.h>
+#endif
+
+// Functions which shall run at compile time only, 
+// are consteval if the standard is C++20 or later, else constexpr. 
+#if __cplusplus >= 202002L
+#define INI_CONSTEVAL consteval
+#else
+#define INI_CONSTEVAL constexpr
+#endif
 
 namespace ini
 {
+    /**
+     * The encodings of binary data as text in a field, see t_Blob. 
+     */
+    enum BlobEncoding
+    {
+        // two lower case hexadecimal digits per byte; 
+        // upper case is accepted when decoding 
+        BLOB_HEX,
+        // base64 of RFC 4648 with padding; 
+        // when decoding the padding may be missing 
+        BLOB_BASE64
+    };
+
+    /**
+     * Encodes binary data as text and decodes it back 
+     * for IniField#assignBytes() and IniField#tryAsBytes(). 
+     * Blocks are processed by SIMD kernels if available, 
+     * see SIMD_PREVENTED, the rest by scalar code. 
+     * The scalar functions are public to compare the results. 
+     */
+    class BlobCodec
+    {
+    public:
+        /**
+	 * Returns the number of characters encoding \p numBytes bytes. 
+	 */
+        static std::size_t encodedLength(BlobEncoding enc,
+					 std::size_t numBytes)
+        {
+	    return enc == BLOB_HEX ? 2 * numBytes : (numBytes + 2) / 3 * 4;
+	}
+
+        /**
+	 * Writes the #encodedLength(BlobEncoding, std::size_t) characters 
+	 * encoding the \p numBytes bytes at \p bytes to \p text. 
+	 */
+        static void encode(BlobEncoding enc,
+			   const std::uint8_t *bytes, std::size_t numBytes,
+			   char *text)
+        {
+	    std::size_t numDone = 0;
+	    if (enc == BLOB_HEX)
+	    {
+#ifdef INI_SIMD_X86
+	        numDone = encodeHexSse2(bytes, numBytes, text);
+#endif
+		encodeHexScalar(bytes + numDone, numBytes - numDone,
+				text + 2 * numDone);
+		return;
+	    }
+#ifdef INI_SIMD_X86
+	    if (hasSsse3())
+	        numDone = encodeBase64Ssse3(bytes, numBytes, text);
+#endif
+	    encodeBase64Scalar(bytes + numDone, numBytes - numDone,
+			       text + numDone / 3 * 4);
+	}
+
+        /**
+	 * Decodes \p text into \p bytes replacing their content 
+	 * and returns whether \p text is well formed. 
+	 * If not, the content of \p bytes is unspecified. 
+	 */
+        static bool decode(BlobEncoding enc, std::string_view text,
+			   std::vector<std::uint8_t> &bytes)
+        {
+	    std::size_t numDone = 0;
+	    if (enc == BLOB_HEX)
+	    {
+	        if (text.size() % 2 != 0)
+		    return false;
+		bytes.resize(text.size() / 2);
+#ifdef INI_SIMD_X86
+		numDone = decodeHexSse2(text.data(), text.size(), bytes.data());
+#endif
+		return decodeHexScalar(text.data() + numDone,
+				       text.size() - numDone,
+				       bytes.data() + numDone / 2);
+	    }
+	    std::size_t len = text.size();
+	    if (len % 4 == 0 && len != 0 && text[len - 1] == '=')
+	        len -= text[len - 2] == '=' ? 2 : 1;
+	    if (len % 4 == 1)
+	        return false;
+	    bytes.resize(len / 4 * 3 + (len % 4 == 0 ? 0 : len % 4 - 1));
+#ifdef INI_SIMD_X86
+	    if (hasSsse3())
+	        numDone = decodeBase64Ssse3(text.data(), len, bytes.data());
+#endif
+	    return decodeBase64Scalar(text.data() + numDone, len - numDone,
+				      bytes.data() + numDone / 4 * 3);
+	}
+
+        static void encodeHexScalar(const std::uint8_t *bytes,
+				    std::size_t numBytes, char *text)
+        {
+	    static const char DIGITS[] = "0123456789abcdef";
+	    for (std::size_t idx = 0; idx < numBytes; idx++)
+	    {
+	        text[2 * idx]     = DIGITS[bytes[idx] >> 4];
+		text[2 * idx + 1] = DIGITS[bytes[idx] & 0x0f];
+	    }
+	}
+
+        /**
+	 * Decodes the even number \p numChars of hexadecimal digits 
+	 * at \p text into \p bytes returning whether all are digits. 
+	 */
+        static bool decodeHexScalar(const char *text, std::size_t numChars,
+				    std::uint8_t *bytes)
+        {
+	    const std::uint8_t *values = hexValues();
+	    for (std::size_t idx = 0; idx < numChars; idx += 2)
+	    {
+	        unsigned int high = values[(unsigned char)text[idx]];
+		unsigned int low  = values[(unsigned char)text[idx + 1]];
+		if (((high | low) & INVALID) != 0)
+		    return false;
+		bytes[idx / 2] = (std::uint8_t)(high << 4 | low);
+	    }
+	    return true;
+	}
+
+        /**
+	 * Encodes \p numBytes bytes including the padding at the end. 
+	 */
+        static void encodeBase64Scalar(const std::uint8_t *bytes,
+				       std::size_t numBytes, char *text)
+        {
+	    static const char DIGITS[] =
+	        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+	    std::size_t idx = 0;
+	    for (; idx + 3 <= numBytes; idx += 3, text += 4)
+	    {
+	        std::uint32_t triple = (std::uint32_t)bytes[idx] << 16
+		  | (std::uint32_t)bytes[idx + 1] << 8 | bytes[idx + 2];
+		text[0] = DIGITS[triple >> 18];
+		text[1] = DIGITS[(triple >> 12) & 0x3f];
+		text[2] = DIGITS[(triple >> 6) & 0x3f];
+		text[3] = DIGITS[triple & 0x3f];
+	    }
+	    if (idx == numBytes)
+	        return;
+	    std::uint32_t triple = (std::uint32_t)bytes[idx] << 16;
+	    if (idx + 2 == numBytes)
+	        triple |= (std::uint32_t)bytes[idx + 1] << 8;
+	    text[0] = DIGITS[triple >> 18];
+	    text[1] = DIGITS[(triple >> 12) & 0x3f];
+	    text[2] = idx + 2 == numBytes ? DIGITS[(triple >> 6) & 0x3f] : '=';
+	    text[3] = '=';
+	}
+
+        /**
+	 * Decodes \p numChars base64 digits without padding 
+	 * at \p text into \p bytes returning whether all are digits. 
+	 * \p numChars modulo 4 must not be 1. 
+	 */
+        static bool decodeBase64Scalar(const char *text, std::size_t numChars,
+				       std::uint8_t *bytes)
+        {
+	    const std::uint8_t *values = base64Values();
+	    std::size_t idx = 0;
+	    for (; idx + 4 <= numChars; idx += 4, bytes += 3)
+	    {
+	        std::uint32_t val0 = values[(unsigned char)text[idx]];
+		std::uint32_t val1 = values[(unsigned char)text[idx + 1]];
+		std::uint32_t val2 = values[(unsigned char)text[idx + 2]];
+		std::uint32_t val3 = values[(unsigned char)text[idx + 3]];
+		if (((val0 | val1 | val2 | val3) & INVALID) != 0)
+		    return false;
+		std::uint32_t quad = val0 << 18 | val1 << 12 | val2 << 6 | val3;
+		bytes[0] = (std::uint8_t)(quad >> 16);
+		bytes[1] = (std::uint8_t)(quad >> 8);
+		bytes[2] = (std::uint8_t)quad;
+	    }
+	    if (idx == numChars)
+	        return true;
+	    std::uint32_t val0 = values[(unsigned char)text[idx]];
+	    std::uint32_t val1 = values[(unsigned char)text[idx + 1]];
+	    std::uint32_t val2 = idx + 3 == numChars
+	        ? values[(unsigned char)text[idx + 2]] : 0;
+	    if (((val0 | val1 | val2) & INVALID) != 0)
+	        return false;
+	    std::uint32_t quad = val0 << 18 | val1 << 12 | val2 << 6;
+	    bytes[0] = (std::uint8_t)(quad >> 16);
+	    if (idx + 3 == numChars)
+	        bytes[1] = (std::uint8_t)(quad >> 8);
+	    return true;
+	}
+
+    private:
+        // the value of characters which are no digits 
+        static const std::uint8_t INVALID = 0x80;
+
+        /**
+	 * Returns the values of the hexadecimal digits indexed by character 
+	 * and #INVALID for all other characters. 
+	 */
+        static const std::uint8_t *hexValues()
+        {
+	    static const struct Table
+	    {
+	        std::uint8_t values[256];
+		Table()
+		{
+		    for (int chr = 0; chr < 256; chr++)
+		        values[chr] = chr >= '0' && chr <= '9' ? chr - '0'
+			  : chr >= 'a' && chr <= 'f' ? chr - 'a' + 10
+			  : chr >= 'A' && chr <= 'F' ? chr - 'A' + 10 : INVALID;
+		}
+	    } TABLE;
+	    return TABLE.values;
+	}
+
+        /**
+	 * Returns the values of the base64 digits indexed by character 
+	 * and #INVALID for all other characters including '='. 
+	 */
+        static const std::uint8_t *base64Values()
+        {
+	    static const struct Table
+	    {
+	        std::uint8_t values[256];
+		Table()
+		{
+		    for (int chr = 0; chr < 256; chr++)
+		        values[chr] = chr >= 'A' && chr <= 'Z' ? chr - 'A'
+			  : chr >= 'a' && chr <= 'z' ? chr - 'a' + 26
+			  : chr >= '0' && chr <= '9' ? chr - '0' + 52
+			  : chr == '+' ? 62 : chr == '/' ? 63 : INVALID;
+		}
+	    } TABLE;
+	    return TABLE.values;
+	}
+
+#ifdef INI_SIMD_X86
+        static bool hasSsse3()
+        {
+	    static const bool HAS_SSSE3 = __builtin_cpu_supports("ssse3");
+	    return HAS_SSSE3;
+	}
+
+        /**
+	 * Encodes blocks of 16 bytes and returns the number of bytes done. 
+	 */
+        static std::size_t encodeHexSse2(const std::uint8_t *bytes,
+					 std::size_t numBytes, char *text)
+        {
+	    const __m128i mask = _mm_set1_epi8(0x0f);
+	    const __m128i nine = _mm_set1_epi8(9);
+	    const __m128i zero = _mm_set1_epi8('0');
+	    const __m128i toLetter = _mm_set1_epi8('a' - '0' - 10);
+	    std::size_t idx = 0;
+	    for (; idx + 16 <= numBytes; idx += 16)
+	    {
+	        __m128i in = _mm_loadu_si128((const __m128i *)(bytes + idx));
+		__m128i high = _mm_and_si128(_mm_srli_epi16(in, 4), mask);
+		__m128i low  = _mm_and_si128(in, mask);
+		high = _mm_add_epi8(_mm_add_epi8(high, zero),
+				    _mm_and_si128(_mm_cmpgt_epi8(high, nine),
+						  toLetter));
+		low  = _mm_add_epi8(_mm_add_epi8(low, zero),
+				    _mm_and_si128(_mm_cmpgt_epi8(low, nine),
+						  toLetter));
+		_mm_storeu_si128((__m128i *)(text + 2 * idx),
+				 _mm_unpacklo_epi8(high, low));
+		_mm_storeu_si128((__m128i *)(text + 2 * idx + 16),
+				 _mm_unpackhi_epi8(high, low));
+	    }
+	    return idx;
+	}
+
+        /**
+	 * Decodes blocks of 16 digits up to the first invalid one 
+	 * and returns the number of characters done. 
+	 */
+        static std::size_t decodeHexSse2(const char *text, std::size_t numChars,
+					 std::uint8_t *bytes)
+        {
+	    const __m128i nine = _mm_set1_epi8(9);
+	    const __m128i five = _mm_set1_epi8(5);
+	    std::size_t idx = 0;
+	    for (; idx + 16 <= numChars; idx += 16)
+	    {
+	        __m128i in = _mm_loadu_si128((const __m128i *)(text + idx));
+		__m128i digit = _mm_sub_epi8(in, _mm_set1_epi8('0'));
+		__m128i isDigit = _mm_cmpeq_epi8(_mm_min_epu8(digit, nine), digit);
+		__m128i letter = _mm_sub_epi8(_mm_or_si128(in, _mm_set1_epi8(0x20)),
+					      _mm_set1_epi8('a'));
+		__m128i isLetter = _mm_cmpeq_epi8(_mm_min_epu8(letter, five),
+						  letter);
+		if (_mm_movemask_epi8(_mm_or_si128(isDigit, isLetter)) != 0xffff)
+		    break;
+		__m128i nibbles = _mm_or_si128
+		  (_mm_and_si128(isDigit, digit),
+		   _mm_and_si128(isLetter,
+				 _mm_add_epi8(letter, _mm_set1_epi8(10))));
+		// the first digit of a byte is the low half of a 16 bit lane 
+		__m128i pairs = _mm_or_si128
+		  (_mm_and_si128(_mm_slli_epi16(nibbles, 4),
+				 _mm_set1_epi16(0x00f0)),
+		   _mm_srli_epi16(nibbles, 8));
+		_mm_storel_epi64((__m128i *)(bytes + idx / 2),
+				 _mm_packus_epi16(pairs, pairs));
+	    }
+	    return idx;
+	}
+
+        /**
+	 * Encodes blocks of 12 bytes while 16 are readable 
+	 * and returns the number of bytes done. 
+	 */
+        __attribute__((target("ssse3")))
+        static std::size_t encodeBase64Ssse3(const std::uint8_t *bytes,
+					     std::size_t numBytes, char *text)
+        {
+	    const __m128i shuffle = _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7,
+						 4, 5, 3, 4, 1, 2, 0, 1);
+	    const __m128i offsets = _mm_setr_epi8(65, 71, -4, -4, -4, -4, -4, -4,
+						  -4, -4, -4, -4, -19, -16, 0, 0);
+	    std::size_t idx = 0;
+	    for (; idx + 16 <= numBytes; idx += 12, text += 16)
+	    {
+	        __m128i in = _mm_shuffle_epi8
+		  (_mm_loadu_si128((const __m128i *)(bytes + idx)), shuffle);
+		// split each 3 bytes into 4 values of 6 bits each 
+		__m128i values = _mm_or_si128
+		  (_mm_mulhi_epu16(_mm_and_si128(in, _mm_set1_epi32(0x0fc0fc00)),
+				   _mm_set1_epi32(0x04000040)),
+		   _mm_mullo_epi16(_mm_and_si128(in, _mm_set1_epi32(0x003f03f0)),
+				   _mm_set1_epi32(0x01000010)));
+		// map the ranges of values to their offsets to the characters 
+		__m128i ranges = _mm_sub_epi8
+		  (_mm_subs_epu8(values, _mm_set1_epi8(51)),
+		   _mm_cmpgt_epi8(values, _mm_set1_epi8(25)));
+		_mm_storeu_si128((__m128i *)text,
+				 _mm_add_epi8(values,
+					      _mm_shuffle_epi8(offsets, ranges)));
+	    }
+	    return idx;
+	}
+
+        /**
+	 * Decodes blocks of 16 digits up to the first invalid one 
+	 * while 16 bytes are writable 
+	 * and returns the number of characters done. 
+	 */
+        __attribute__((target("ssse3")))
+        static std::size_t decodeBase64Ssse3(const char *text,
+					     std::size_t numChars,
+					     std::uint8_t *bytes)
+        {
+	    // bit sets of the classes of low and high nibbles 
+	    // which do not occur together in digits 
+	    const __m128i lowClasses = _mm_setr_epi8
+	      (0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+	       0x11, 0x11, 0x13, 0x1a, 0x1b, 0x1b, 0x1b, 0x1a);
+	    const __m128i highClasses = _mm_setr_epi8
+	      (0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+	       0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+	    // offsets from characters to values by high nibble, 
+	    // the one at index 1 for '/' 
+	    const __m128i offsets = _mm_setr_epi8
+	      (0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+	    const __m128i mask = _mm_set1_epi8(0x0f);
+	    const __m128i slash = _mm_set1_epi8('/');
+	    const __m128i order = _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8,
+						14, 13, 12, -1, -1, -1, -1);
+	    std::size_t idx = 0;
+	    std::size_t numBytes = numChars / 4 * 3;
+	    for (; idx + 16 <= numChars && idx / 4 * 3 + 16 <= numBytes;
+		 idx += 16, bytes += 12)
+	    {
+	        __m128i in = _mm_loadu_si128((const __m128i *)(text + idx));
+		__m128i high = _mm_and_si128(_mm_srli_epi32(in, 4), mask);
+		__m128i low  = _mm_and_si128(in, mask);
+		__m128i invalid = _mm_and_si128(_mm_shuffle_epi8(lowClasses, low),
+						_mm_shuffle_epi8(highClasses, high));
+		if (_mm_movemask_epi8(_mm_cmpeq_epi8(invalid,
+						     _mm_setzero_si128()))
+		    != 0xffff)
+		    break;
+		__m128i values = _mm_add_epi8
+		  (in, _mm_shuffle_epi8(offsets,
+					_mm_add_epi8(_mm_cmpeq_epi8(in, slash),
+						     high)));
+		// merge 4 values of 6 bits each into 3 bytes 
+		__m128i merged = _mm_madd_epi16
+		  (_mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140)),
+		   _mm_set1_epi32(0x00011000));
+		_mm_storeu_si128((__m128i *)bytes,
+				 _mm_shuffle_epi8(merged, order));
+	    }
+	    return idx;
+	}
+#endif
+    }; // class BlobCodec
+
+    /**
+     * Binary data to be assigned to an IniField and to be read from it 
+     * encoded as text by \p ENC: 
+     * <c>field.as<ini::Base64Blob>().bytes</c>. 
+     */
+    template<BlobEncoding ENC>
+    class t_Blob
+    {
+    public:
+        std::vector<std::uint8_t> bytes;
+
+        t_Blob()
+        {}
+
+        explicit t_Blob(std::vector<std::uint8_t> bytes)
+	  : bytes(std::move(bytes))
+        {}
+    }; // class t_Blob
+
+    typedef t_Blob<BLOB_HEX> HexBlob;
+    typedef t_Blob<BLOB_BASE64> Base64Blob;
+
+    /**
+     * The result of splitting a field into a list of elements 
+     * by IniField#forEachElement() or IniField#tryAsVector(): 
+     * the number of elements converted 
+     * and the index of the element which could not be converted if any. 
+     */
+    class SplitResult
+    {
+    public:
+        static const std::size_t NO_FAILURE = (std::size_t)-1;
+
+        std::size_t numElements = 0;
+        std::size_t idxFailed = NO_FAILURE;
+
+        bool isOk() const
+        {
+	    return idxFailed == NO_FAILURE;
+	}
+    }; // class SplitResult
+
+    /**
+     * Reads a value in chunks of a given size, see IniField#reader(). 
+     * The chunks are views into the value 
+     * which stay valid as long as the field is not assigned or destroyed. 
+     */
+    class ValueReader
+    {
+    private:
+        std::string_view value_;
+        std::size_t chunkSize_;
+        std::size_t pos_;
+    public:
+        ValueReader(std::string_view value, std::size_t chunkSize)
+          : value_(value),
+            chunkSize_(chunkSize == 0 ? 1 : chunkSize),
+            pos_(0)
+        {}
+
+        /**
+	 * Sets \p chunk to the next chunk 
+	 * which is shorter than the chunk size only at the end 
+	 * and returns whether there was one left. 
+	 */
+        bool next(std::string_view &chunk)
+        {
+	    if (pos_ >= value_.size())
+	        return false;
+	    chunk = value_.substr(pos_, chunkSize_);
+	    pos_ += chunk.size();
+	    return true;
+	}
+
+        /**
+	 * Returns the length of the whole value. 
+	 */
+        std::size_t size() const
+        {
+	    return value_.size();
+	}
+
+        /**
+	 * Returns the number of characters not yet read. 
+	 */
+        std::size_t remaining() const
+        {
+	    return value_.size() - pos_;
+	}
+    }; // class ValueReader
+
     /**
      * Represents a value in a key value pair of an ini-file. 
      */
     class IniField
     {
     private:
+        /**
+	 * The kinds of values a field holds: 
+	 * TEXT if assigned a string or decoded, 
+	 * EXTERNAL if referring to a large value in a file loaded, 
+	 * else the type of the number or bool assigned last 
+	 * which is kept in #native_ and formatted only on demand. 
+	 */
+        enum Kind : unsigned char
+        {
+	    TEXT, INT, UINT, LONG, ULONG, DOUBLE, FLOAT, BOOL, EXTERNAL
+	};
+
         /**
 	 * Represents the value as a string which may be empty. 
+	 * Unless #formatted_ is set, it is out of date 
+	 * and #native_ holds the value. 
+	 */
+        mutable std::string value_;
+
+        /**
+	 * The value assigned last unless #kind_ is TEXT: 
+	 * signed integers as long, unsigned ones as unsigned long 
+	 * and float as double. 
+	 * If #kind_ is EXTERNAL, the length of the value at #external_. 
+	 */
+        union
+        {
+	    long int l;
+	    unsigned long int ul;
+	    double d;
+	    bool b;
+	} native_;
+
+        Kind kind_;
+
+#ifdef THREADS_PREVENTED
+        typedef bool Flag;
+#else
+        /**
+	 * A bool which may be set by one thread while others read it, 
+	 * copyable unlike std::atomic. 
+	 */
+        class Flag
+        {
+        private:
+            std::atomic<bool> value_;
+        public:
+            Flag(bool value) : value_(value)
+            {}
+            Flag(const Flag &flag) : value_((bool)flag)
+            {}
+            Flag &operator=(const Flag &flag)
+            {
+                return *this = (bool)flag;
+            }
+            Flag &operator=(bool value)
+            {
+                value_.store(value, std::memory_order_release);
+                return *this;
+            }
+            operator bool() const
+            {
+                return value_.load(std::memory_order_acquire);
+            }
+        }; // class Flag
+#endif
+
+        /**
+	 * Whether #value_ is up to date; always if #kind_ is TEXT. 
+	 * It is set only after #value_ is written, 
+	 * so that const methods may read a field concurrently. 
 	 */
-        std::string value_;
+        mutable Flag formatted_;
+
+        /**
+	 * The start of the value if #kind_ is EXTERNAL, else NULL. 
+	 * It shares ownership of the buffer or mapping holding the value 
+	 * which is freed with the last field referring to it. 
+	 */
+        std::shared_ptr<const char> external_;
 
         /**
 	 * The type of the last outgoing cast conversion from value_. 
 	 * This is insignificant and NULL if there was no out conversion yet. 
 	 * This is used only to create an appropriate message 
 	 * for exception in #as(). 
+	 * It points to a string literal so that conversions do not allocate. 
 	 */
-        mutable std::string typeLastOutConversion_;
+        mutable const char *typeLastOutConversion_;
 
     /**
 	 * Whether the last outgoing cast conversion from value_ 
 	 * e.g. into <c>int</> failed. 
 	 * This is insignificant but false if there was no out conversion yet. 
 	 * This is used by #as() to throw an exception 
-	 * and by #orDefault(T) to set the defalt value. 
+	 * and is set also by #orDefault(T). 
 	 *
 	 * @see failedLastOutConversion()
 	 */
-        mutable bool failedLastOutConversion_;
+        mutable Flag failedLastOutConversion_;
       
     /**
 	 * Whether any ingoing cast conversion to value_ 
@@ -76,36 +711,249 @@ namespace ini
 	 * This is used by #as() to throw an exception 
 	 * and by #orDefault(T) to set the defalt value. 
 	 *
+	 * As numbers are formatted on demand only, 
+	 * this is set when formatting. 
+	 *
 	 * @see failedAnyInConversion()
 	 */
-        bool failedAnyInConversion_;
+        mutable bool failedAnyInConversion_;
+
+        /**
+	 * Returns #value_ after formatting #native_ into it if necessary. 
+	 */
+        const std::string &text() const
+        {
+	    if (!formatted_)
+	        format();
+	    return value_;
+	}
+
+#ifndef THREADS_PREVENTED
+        /**
+	 * Serializes #format() of all fields, 
+	 * as fields of a document shared by IniFile#tryLoadShared 
+	 * may be formatted by several threads at once. 
+	 * This is locked once per field only. 
+	 */
+        static std::mutex &formatMutex()
+        {
+	    static std::mutex mutex;
+	    return mutex;
+	}
+#endif
+
+        /**
+	 * Formats #native_ into #value_ according to #kind_ 
+	 * or copies a value referred to if #kind_ is EXTERNAL. 
+	 */
+        void format() const
+        {
+#ifndef THREADS_PREVENTED
+	    std::lock_guard<std::mutex> lock(formatMutex());
+	    if (formatted_)
+	        return;
+#endif
+	    switch (kind_)
+	    {
+	    case INT:
+	        formatNum10("%d", (int)native_.l);
+		break;
+	    case UINT:
+	        formatNum10("%u", (unsigned int)native_.ul);
+		break;
+	    case LONG:
+	        formatNum10("%ld", native_.l);
+		break;
+	    case ULONG:
+	        formatNum10("%lu", native_.ul);
+		break;
+	    case DOUBLE:
+	        formatNum10("%g", native_.d);
+		break;
+	    case FLOAT:
+	        formatNum10("%g", (float)native_.d);
+		break;
+	    case BOOL:
+	        value_ = native_.b ? "true" : "false";
+		break;
+	    case EXTERNAL:
+	        value_.assign(external_.get(), native_.ul);
+		break;
+	    case TEXT:
+	        break;
+	    }
+	    formatted_ = true;
+	}
+
+        /**
+	 * Formats the number \p value into #value_ 
+	 * with format string \p formatStr if streams are prevented, 
+	 * else with a stringstream. 
+	 */
+        template<typename T>
+        void formatNum10(const char *formatStr, T value) const
+        {
+#ifdef SSTREAM_PREVENTED
+	    value_ = convertNum10<T>(formatStr, value);
+#else
+	    (void)formatStr;
+            std::stringstream ss;
+            ss << value;
+            value_ = ss.str();
+#endif
+	}
+
+        /**
+	 * Assigns the number or bool \p value of kind \p kind 
+	 * to be formatted on demand. 
+	 */
+        template<typename T>
+        IniField &assignNative(Kind kind, T value)
+        {
+	    kind_ = kind;
+	    formatted_ = false;
+	    external_.reset();
+	    switch (kind)
+	    {
+	    case INT:
+	    case LONG:
+	        native_.l = (long int)value;
+		break;
+	    case UINT:
+	    case ULONG:
+	        native_.ul = (unsigned long int)value;
+		break;
+	    case DOUBLE:
+	    case FLOAT:
+	        native_.d = (double)value;
+		break;
+	    case BOOL:
+	        native_.b = (bool)value;
+		break;
+	    case EXTERNAL:
+	    case TEXT:
+	        break;
+	    }
+	    return *this;
+	}
+
+        /**
+	 * Marks #value_ as holding the value just assigned as text. 
+	 */
+        void assignText()
+        {
+	    kind_ = TEXT;
+	    formatted_ = true;
+	    external_.reset();
+	}
       
 
     public:
       // TBC: needed? 
         IniField()
 	   : value_(),
-	     typeLastOutConversion_(),
+	     native_(),
+	     kind_(TEXT),
+	     formatted_(true),
+	     typeLastOutConversion_(NULL),
 	     failedLastOutConversion_(false),
 	     failedAnyInConversion_(false)
           {}
 
         IniField(const std::string &value)
 	  : value_(value),
-	    typeLastOutConversion_(),
+	    native_(),
+	    kind_(TEXT),
+	    formatted_(true),
+	    typeLastOutConversion_(NULL),
+	    failedLastOutConversion_(false),
+	    failedAnyInConversion_(false)
+        {}
+
+        IniField(std::string &&value)
+	  : value_(std::move(value)),
+	    native_(),
+	    kind_(TEXT),
+	    formatted_(true),
+	    typeLastOutConversion_(NULL),
 	    failedLastOutConversion_(false),
 	    failedAnyInConversion_(false)
         {}
+
+        /**
+	 * Refers to the value of \p length characters at \p data 
+	 * without copying it until text is requested, see #view(). 
+	 * This field shares ownership of \p data. 
+	 */
+        IniField(std::shared_ptr<const char> data, std::size_t length)
+	  : value_(),
+	    native_(),
+	    kind_(EXTERNAL),
+	    formatted_(false),
+	    external_(std::move(data)),
+	    typeLastOutConversion_(NULL),
+	    failedLastOutConversion_(false),
+	    failedAnyInConversion_(false)
+        {
+	    native_.ul = length;
+	}
+
         IniField(const IniField &field)
 	  : value_(field.value_),
+	    native_(field.native_),
+	    kind_(field.kind_),
+	    formatted_(field.formatted_),
+	    external_(field.external_),
 	    typeLastOutConversion_  (field.typeLastOutConversion_),
 	    failedLastOutConversion_(field.failedLastOutConversion_),
 	    failedAnyInConversion_  (field.failedAnyInConversion_)
 
         {}
 
-        ~IniField()
-        {}
+        /**
+	 * Moves the value of \p field; 
+	 * noexcept so that vectors of fields move instead of copying 
+	 * when growing. 
+	 */
+        IniField(IniField &&field) noexcept
+	  : value_(std::move(field.value_)),
+	    native_(field.native_),
+	    kind_(field.kind_),
+	    formatted_(field.formatted_),
+	    external_(std::move(field.external_)),
+	    typeLastOutConversion_  (field.typeLastOutConversion_),
+	    failedLastOutConversion_(field.failedLastOutConversion_),
+	    failedAnyInConversion_  (field.failedAnyInConversion_)
+        {}
+
+        ~IniField()
+        {}
+
+        IniField &operator=(const IniField &field)
+        {
+	    value_ = field.value_;
+	    native_ = field.native_;
+	    kind_ = field.kind_;
+	    formatted_ = field.formatted_;
+	    external_ = field.external_;
+	    typeLastOutConversion_   = field.typeLastOutConversion_;
+	    failedLastOutConversion_ = field.failedLastOutConversion_;
+	    failedAnyInConversion_   = field.failedAnyInConversion_;
+	    return *this;
+	}
+
+        IniField &operator=(IniField &&field) noexcept
+        {
+	    value_ = std::move(field.value_);
+	    native_ = field.native_;
+	    kind_ = field.kind_;
+	    formatted_ = field.formatted_;
+	    external_ = std::move(field.external_);
+	    typeLastOutConversion_   = field.typeLastOutConversion_;
+	    failedLastOutConversion_ = field.failedLastOutConversion_;
+	    failedAnyInConversion_   = field.failedAnyInConversion_;
+	    return *this;
+	}
 
         // template<typename T>
         // T as() const
@@ -130,17 +978,87 @@ namespace ini
 	    T result = asUnconditional<T>();
 	    if (failedLastOutConversion_)
 	      throw std::invalid_argument
-		("field '" + value_ + "' is no " + typeLastOutConversion_);
+		("field '" + text() + "' is no " + typeLastOutConversion_);
             return result;
         }
 #endif
 
+        /**
+	 * Returns the value as a \p T or \p defaultValue if it is no \p T, 
+	 * recording only the latter in #failedLastOutConversion(). 
+	 */
         template<typename T>
-        T orDefault(T defaultValue)
+        T orDefault(T defaultValue) const
         {
-	    T result = static_cast<T>(*this);
-	    return failedLastOutConversion_ ? defaultValue : result;
+	    T result;
+	    bool succ = tryConvert(result);
+	    failedLastOutConversion_ = !succ;
+	    if (!succ)
+	        return defaultValue;
+	    return result;
  	}
+
+        /**
+	 * Splits the value at \p delim into elements trimmed of blanks, 
+	 * converts each into a \p T and passes it to \p callback. 
+	 * Stops at the first element which cannot be converted 
+	 * and records its index in the result. 
+	 * An empty value has no elements. 
+	 * For \p T std::string_view the elements are views into this field, 
+	 * for all other types except std::string this does not allocate. 
+	 * Numbers are decimal as for <c>std::from_chars</c>, 
+	 * unlike single values which may also be octal or hexadecimal. 
+	 *
+	 * @param callback
+	 *    invoked with a \p T for each element in order. 
+	 */
+        template<typename T, typename F>
+        SplitResult forEachElement(char delim, F &&callback) const
+        {
+	    SplitResult result;
+	    std::string_view value = view();
+	    if (value.empty())
+	        return result;
+	    const char *pos = value.data();
+	    const char *end = pos + value.size();
+	    T elem;
+	    for (;;)
+	    {
+		if (!parseNextElement(pos, end, delim, elem))
+		{
+		    result.idxFailed = result.numElements;
+		    return result;
+		}
+		callback(elem);
+		result.numElements++;
+		// pos is at the delimiter or at the end 
+		if (pos == end)
+		    return result;
+		pos++;
+	    }
+	}
+
+        /**
+	 * Converts the value into a list of \p T 
+	 * like #forEachElement(char, F&&) 
+	 * replacing the content of \p values 
+	 * with a single allocation at most. 
+	 * If an element cannot be converted, 
+	 * \p values holds the elements before. 
+	 */
+        template<typename T>
+        SplitResult tryAsVector(std::vector<T> &values, char delim = ',') const
+        {
+	    std::string_view value = view();
+	    values.clear();
+	    if (!value.empty())
+	        values.reserve(std::count(value.begin(), value.end(), delim) + 1);
+	    return forEachElement<T>(delim,
+				     [&values](const T &elem)
+				     {
+				         values.push_back(elem);
+				     });
+	}
       
         // template<typename T>
         // T &operator ||(T defaultValue)
@@ -149,12 +1067,61 @@ namespace ini
 	//     return failedLastOutConversion_ ? defaultValue : result;
  	// }
 
-        const std::string toString() const
+        /**
+	 * Returns the value as text, 
+	 * formatting a number or bool assigned if not yet done. 
+	 */
+        const std::string &toString() const
         {
-	    return value_;
+	    return text();
+	}
+
+        /**
+	 * Returns the value as text like #toString() without copying. 
+	 * If a number assigned must be formatted first 
+	 * and memory is exhausted doing so, this terminates. 
+	 */
+        const std::string &str() const noexcept
+        {
+	    return text();
+	}
+
+        /**
+	 * Returns a view of the value as text, see #str(). 
+	 * It is valid until the field is assigned or destroyed. 
+	 * A large value referred to in a file loaded, see #isExternal(), 
+	 * is viewed in place without copying. 
+	 */
+        std::string_view view() const noexcept
+        {
+	    if (kind_ == EXTERNAL)
+	        return std::string_view(external_.get(), native_.ul);
+	    return text();
+	}
+
+        /**
+	 * Returns whether the value is a large one 
+	 * referred to in the file loaded 
+	 * as described for IniFile#setLargeValueThreshold(std::size_t). 
+	 * Then #view() and #reader() do not copy, 
+	 * whereas #toString(), #str() and conversions copy the value once, 
+	 * also if called by several threads at once. 
+	 */
+        bool isExternal() const
+        {
+	    return kind_ == EXTERNAL;
+	}
+
+        /**
+	 * Returns a reader yielding the value as text 
+	 * in chunks of \p chunkSize characters, based on #view(). 
+	 */
+        ValueReader reader(std::size_t chunkSize = 65536) const
+        {
+	    return ValueReader(view(), chunkSize);
 	}
 
-        bool failedLastOutConversion()
+        bool failedLastOutConversion() const
         {
 	  return failedLastOutConversion_;
 	}
@@ -180,17 +1147,10 @@ namespace ini
 
         // TBD: works for decimal only; extend
       // NOTE: used for converting numbers only, both integers and floats.
-      // Using sprintf is ok except for long int types:
-      // then the trailing l must be removed. 
-      // As in the cases under consideration, l occurs for long types only
-      // and then it is at the end of the string,
-      // it suffices to find pointer on 'l' and set '\0'. 
-      // this works only because l occurs for long types T only.
       //
         /**
 	 * Returns \p value as a string using the format string \p formatStr. 
 	 * This must fit the type. 
-	 * Note that for long int types, the result has no trailing 'l'. 
 	 * As a side effect, conversion failures are cumulated 
 	 * in #failedAnyInConversion_, which should not occur. 
 	 *
@@ -203,14 +1163,13 @@ namespace ini
 	 *    a format string which must fit the type. 
 	 */
         template<typename T>
-	std::string convertNum10(const char* formatStr, T value)
-        {
-	    char strVal[std::numeric_limits<T>::digits10];
-	    int succ = sprintf(strVal, formatStr, value);
-	    failedAnyInConversion_ |= succ < 0;
-	    char* lChar = strchr(strVal, 'l');
-	    if (lChar)
-	        *lChar = '\0';
+	std::string convertNum10(const char* formatStr, T value) const
+        {
+	    // enough for all integers up to 64 bit and for %g 
+	    // including sign and terminating '\0' 
+	    char strVal[32];
+	    int succ = snprintf(strVal, sizeof(strVal), formatStr, value);
+	    failedAnyInConversion_ |= succ < 0 || succ >= (int)sizeof(strVal);
 	    // TBD: evaluate succ: < 0 if sth went wrong.
 	    // else number of variables written. should be 1
 	    return std::string(strVal);
@@ -225,49 +1184,58 @@ namespace ini
         IniField &operator=(const char *value)
         {
             value_ = std::string(value);
+	    assignText();
             return *this;
         }
 
         IniField &operator=(const std::string &value)
         {
             value_ = value;
+	    assignText();
             return *this;
         }
 
-        IniField &operator=(const int value)
+        IniField &operator=(std::string &&value)
         {
-#ifdef SSTREAM_PREVENTED
-	    value_ = convertNum10<int>("%d", value);
-#else
-            std::stringstream ss;
-            ss << value;
-            value_ = ss.str();
-#endif
+            value_ = std::move(value);
+	    assignText();
             return *this;
         }
 
+        /**
+	 * Assigns the \p numBytes bytes at \p bytes encoded by \p enc. 
+	 * This encodes directly into the text. 
+	 */
+        IniField &assignBytes(const std::uint8_t *bytes, std::size_t numBytes,
+			      BlobEncoding enc)
+        {
+	    value_.resize(BlobCodec::encodedLength(enc, numBytes));
+	    BlobCodec::encode(enc, bytes, numBytes, &value_[0]);
+	    assignText();
+	    return *this;
+	}
+
+        template<BlobEncoding ENC>
+        IniField &operator=(const t_Blob<ENC> &blob)
+        {
+	    return assignBytes(blob.bytes.data(), blob.bytes.size(), ENC);
+	}
+
+        // numbers and bools are formatted on demand only, see #toString() 
+
+        IniField &operator=(const int value)
+        {
+	    return assignNative(INT, value);
+        }
+
         IniField &operator=(const unsigned int value)
         {
-#ifdef SSTREAM_PREVENTED
-	    value_ = convertNum10<unsigned int>("%u", value);
-#else
-           std::stringstream ss;
-            ss << value;
-            value_ = ss.str();
-#endif
-           return *this;
+	    return assignNative(UINT, value);
         }
 
         IniField &operator=(const long int value)
         {
-#ifdef SSTREAM_PREVENTED
-	    value_ = convertNum10<long int>("%dl", value);
-#else
-           std::stringstream ss;
-            ss << value;
-            value_ = ss.str();
-#endif
-           return *this;
+	    return assignNative(LONG, value);
         }
 
       // TBD: clarify: this writes always decimal representation
@@ -275,44 +1243,22 @@ namespace ini
       // that way conversions are not inverse to one another. 
         IniField &operator=(const unsigned long int value)
         {
-#ifdef SSTREAM_PREVENTED
-	    value_ = convertNum10<unsigned long int>("%ul", value);
-#else
-            std::stringstream ss;
-            ss << value;
-            value_ = ss.str();
-#endif
-           return *this;
+	    return assignNative(ULONG, value);
         }
 
         IniField &operator=(const double value)
         {
-#ifdef SSTREAM_PREVENTED
-	    value_ = convertNum10<double>("%g", value);
-#else
-            std::stringstream ss;
-            ss << value;
-            value_ = ss.str();
-#endif
-            return *this;
+	    return assignNative(DOUBLE, value);
         }
 
         IniField &operator=(const float value)
         {
-#ifdef SSTREAM_PREVENTED
-	    value_ = convertNum10<float>("%g", value);
-#else
-            std::stringstream ss;
-            ss << value;
-            value_ = ss.str();
-#endif
-            return *this;
+	    return assignNative(FLOAT, value);
         }
 
         IniField &operator=(const bool value)
         {
-	    value_ = value ? "true" : "false";
-            return *this;
+	    return assignNative(BOOL, value);
         }
 
         /**********************************************************************
@@ -322,7 +1268,7 @@ namespace ini
         const char* castToCString() const 
         {
 	    failedLastOutConversion_ = false;
-            return value_.c_str();
+            return text().c_str();
 	}
       
         explicit operator const char *() const
@@ -332,25 +1278,23 @@ namespace ini
  	    return result;
         }
 
-        const std::string castToString() const 
+        const std::string &castToString() const 
         {
 	    failedLastOutConversion_ = false;
-            return value_;
+            return text();
 	}
       
         explicit operator std::string() const
         {
 	    typeLastOutConversion_ = "std::string";
-	    const std::string result = castToString();
-            return result;
+            return castToString();
         }
 
  	// strtol has a no throw guarantee 
         long int castToLongIntCheckFail() const 
         {
-            char *endptr;
-            long int result = std::strtol(value_.c_str(), &endptr, 0);
-	    failedLastOutConversion_ = *endptr != '\0' || value_.empty();
+	    long int result;
+	    failedLastOutConversion_ = !parseLongInt(result);
 	    return result;
  	}
 
@@ -362,806 +1306,5861 @@ namespace ini
         explicit operator long int() const
         {
 	    typeLastOutConversion_ = "long int";
- 	    long int result = castToLongIntCheckFail();
+	    long int result;
+	    failedLastOutConversion_ = !tryConvert(result);
 	    return result;
         }
       
         explicit operator int() const
         {
 	    typeLastOutConversion_ = "int";
-	    long int result = castToLongIntCheckFail();
-
-	    if (result > std::numeric_limits<int>::max())
-	      result = std::numeric_limits<int>::max();
-	    else if (result < std::numeric_limits<int>::min())
-	      result = std::numeric_limits<int>::min();
-	    return (int)result;
+	    int result;
+	    failedLastOutConversion_ = !tryConvert(result);
+	    return result;
         }
 
 	// strtoul has a no throw guarantee 
         unsigned long int castToUnsignedLongIntCheckFail() const 
         {
- 	    char *endptr;
-	    // CAUTION: this delivers a value even if string starts with '-'
-	    unsigned long int result = std::strtoul(value_.c_str(), &endptr, 0);
-	    failedLastOutConversion_ =
-	      *endptr != '\0' || value_.empty() || value_[0] == '-';
+	    unsigned long int result;
+	    failedLastOutConversion_ = !parseUnsignedLongInt(result);
 	    return result;
  	}
 
         explicit operator unsigned long int() const
         {
 	    typeLastOutConversion_ = "unsigned long int";
-	    unsigned long int result = castToUnsignedLongIntCheckFail();
+	    unsigned long int result;
+	    failedLastOutConversion_ = !tryConvert(result);
 	    return result;
         }
 
         explicit operator unsigned int() const
         {
 	    typeLastOutConversion_ = "unsigned int";
-	    unsigned long int result = castToUnsignedLongIntCheckFail();
-
-	    if (result > std::numeric_limits<unsigned int>::max())
-	      result = std::numeric_limits<unsigned int>::max();
+	    unsigned int result;
+	    failedLastOutConversion_ = !tryConvert(result);
 	    return result;
         }
 
  	// strtod has a no throw guarantee 
         double castToDoubleCheckFail() const 
         {
-	    char *endptr;
-	    double result = std::strtod(value_.c_str(), &endptr);
-	    failedLastOutConversion_ = *endptr != '\0' || value_.empty();
+	    double result;
+	    failedLastOutConversion_ = !parseDouble(result);
 	    return result;
 	}
 
         explicit operator double() const
         {
 	    typeLastOutConversion_ = "double";
-	    double result = castToDoubleCheckFail();
+	    double result;
+	    failedLastOutConversion_ = !tryConvert(result);
 	    return result;
         }
 
 	explicit operator float() const
         {
 	    typeLastOutConversion_ = "float";
-	    float result = (float)castToDoubleCheckFail();
+	    float result;
+	    failedLastOutConversion_ = !tryConvert(result);
 	    return result;
 	}
 
 
 
-        explicit operator bool() const
+        /**
+	 * Returns whether #value_ equals \p lower ignoring case, 
+	 * where \p lower is in lower case. 
+	 * Unlike converting a copy to lower case this does not allocate. 
+	 */
+        bool equalsIgnoreCase(const char *lower) const
         {
-	    typeLastOutConversion_ = "bool";
-            std::string str(value_);
-            std::transform(str.begin(), str.end(), str.begin(), ::tolower);
-            if (str == "true")
+	    const std::string &value = text();
+	    std::size_t len = strlen(lower);
+	    if (value.length() != len)
+	        return false;
+	    for (std::size_t idx = 0; idx < len; idx++)
 	    {
-	        failedLastOutConversion_ = false;
-                return true;
+	        if (::tolower((unsigned char)value[idx]) != lower[idx])
+		    return false;
 	    }
-	    failedLastOutConversion_ = (str != "false");
-	    return false;
+	    return true;
+	}
+
+        explicit operator bool() const
+        {
+	    typeLastOutConversion_ = "bool";
+	    bool result;
+	    failedLastOutConversion_ = !tryConvert(result);
+	    return result;
         }
-    };
 
-    template<class T>
-    class NamedObj
-    {
-      // TBD: change
-    public:
-      std::string first;//key_;
-      T second;//value_;
-      NamedObj(std::string key, T value) : first(key), second(value)
-      {
-      }
-      
-    }; // class NamedObj
+        /**
+	 * Decodes the value encoded by \p enc into \p bytes 
+	 * with a single allocation at most 
+	 * and returns whether the value is well formed. 
+	 */
+        bool tryAsBytes(std::vector<std::uint8_t> &bytes,
+			BlobEncoding enc) const
+        {
+	    return BlobCodec::decode(enc, view(), bytes);
+	}
 
- 
-    template<class T>
-    class t_ResVMap
-    {
-    private:
-        std::vector<NamedObj<T>> vec_;
-    public:
-        typedef typename std::vector<NamedObj<T>>::iterator iterator;
-      
-        t_ResVMap()
+        template<BlobEncoding ENC>
+        explicit operator t_Blob<ENC>() const
         {
-        }
+	    typeLastOutConversion_ = ENC == BLOB_HEX ? "hex blob" : "base64 blob";
+	    t_Blob<ENC> result;
+	    failedLastOutConversion_ = !tryConvert(result);
+	    return result;
+	}
 
         /**
-	 * Returns the value corresponding with \p key if there is one, 
-	 * else appends a new T created with default constructor before.
-	 *
-	 * @param key
-	 *    a key in this map. 
+	 * Returns the value as a list of elements separated by ',' 
+	 * as described for #tryAsVector(std::vector<T>&, char). 
 	 */
-        T & operator[](std::string key)
+        template<typename T>
+        explicit operator std::vector<T>() const
         {
-	   for (iterator it = vec_.begin(); it != vec_.end(); it++)
-	   {
-	       if (it->first == key)
-	       {
-		 return it->second;
-	       }
-	   }
-	   T second;
-	   NamedObj<T> obj(key, second);
-	   vec_.push_back(obj);
-	   return vec_[vec_.size()-1].second;
+	    typeLastOutConversion_ = "std::vector";
+	    std::vector<T> result;
+	    failedLastOutConversion_ = !tryConvert(result);
+	    return result;
 	}
 
-        unsigned int size() const
+    private:
+        friend class IniSection;
+
+        // strtol has a no throw guarantee 
+        bool parseLongInt(long int &result) const
         {
-	    return vec_.size();
-        }
+            const std::string &value = text();
+            char *endptr;
+            result = std::strtol(value.c_str(), &endptr, 0);
+	    return *endptr == '\0' && !value.empty();
+	}
 
-        bool contains(std::string key)
+	// strtoul has a no throw guarantee 
+        bool parseUnsignedLongInt(unsigned long int &result) const
         {
-	   for (iterator it = vec_.begin(); it != vec_.end(); it++)
-	   {
-	     if (it->first == key)
-	     {
-	       return true;
-	     }
-	   }
-	   return false;
+ 	    char *endptr;
+	    const std::string &value = text();
+	    // CAUTION: this delivers a value even if string starts with '-'
+	    result = std::strtoul(value.c_str(), &endptr, 0);
+	    return *endptr == '\0' && !value.empty() && value[0] != '-';
 	}
 
-       iterator begin()
+ 	// strtod has a no throw guarantee 
+        bool parseDouble(double &result) const
         {
-	 return vec_.begin();
+	    const std::string &value = text();
+	    char *endptr;
+	    result = std::strtod(value.c_str(), &endptr);
+	    return *endptr == '\0' && !value.empty();
 	}
 
-        iterator end()
+        /**
+	 * Converts the value into \p result like the cast operator into it 
+	 * and returns whether this succeeded. 
+	 * Unlike the cast operators this does not record the outcome 
+	 * in #failedLastOutConversion_ and #typeLastOutConversion_, 
+	 * so that #orDefault(T) and IniSection#get may run concurrently 
+	 * on a field shared between threads. 
+	 * On failure \p result is set as by the cast operator. 
+	 */
+        bool tryConvert(const char *&result) const
         {
-	    return vec_.end();
+	    result = text().c_str();
+	    return true;
 	}
 
-        void clear()
+        bool tryConvert(std::string &result) const
         {
-	    return vec_.clear();
-        }
-    }; // class t_ResVMap
+	    result = text();
+	    return true;
+	}
 
+        bool tryConvert(long int &result) const
+        {
+	    if (kind_ == LONG)
+	    {
+	        result = native_.l;
+		return true;
+	    }
+	    return parseLongInt(result);
+	}
 
-    class IniSection
-    {
-    public:// TBD: later make private again 
-        t_ResVMap<IniField> map;
-    public:
-        IniSection()
-        {}
-        ~IniSection()
-        {}
+        bool tryConvert(int &result) const
+        {
+	    if (kind_ == INT)
+	    {
+	        result = (int)native_.l;
+		return true;
+	    }
+	    long int value;
+	    bool succ = parseLongInt(value);
+	    if (value > std::numeric_limits<int>::max())
+	      value = std::numeric_limits<int>::max();
+	    else if (value < std::numeric_limits<int>::min())
+	      value = std::numeric_limits<int>::min();
+	    result = (int)value;
+	    return succ;
+	}
 
-        IniField & operator[](std::string key)
+        bool tryConvert(unsigned long int &result) const
         {
-	    return map[key];
+	    if (kind_ == ULONG)
+	    {
+	        result = native_.ul;
+		return true;
+	    }
+	    return parseUnsignedLongInt(result);
 	}
 
-        // TBD: in the long run this shall be removed:
-        // this method is not used in application, but for testing. 
-        // In a validating parser, only a bool valued check is necessary. 
-        unsigned int size() const
+        bool tryConvert(unsigned int &result) const
         {
-	    return map.size();
-        }
+	    if (kind_ == UINT)
+	    {
+	        result = (unsigned int)native_.ul;
+		return true;
+	    }
+	    unsigned long int value;
+	    bool succ = parseUnsignedLongInt(value);
+	    if (value > std::numeric_limits<unsigned int>::max())
+	      value = std::numeric_limits<unsigned int>::max();
+	    result = (unsigned int)value;
+	    return succ;
+	}
 
+        bool tryConvert(double &result) const
+        {
+	    if (kind_ == DOUBLE)
+	    {
+	        result = native_.d;
+		return true;
+	    }
+	    return parseDouble(result);
+	}
 
+        bool tryConvert(float &result) const
+        {
+	    if (kind_ == FLOAT)
+	    {
+	        result = (float)native_.d;
+		return true;
+	    }
+	    double value;
+	    bool succ = parseDouble(value);
+	    result = (float)value;
+	    return succ;
+	}
 
-#ifdef SSTREAM_PREVENTED
-        unsigned int lengthText()
+        bool tryConvert(bool &result) const
         {
-	    unsigned int res = 0;
-	    for (const auto &pair : map)
+	    if (kind_ == BOOL)
 	    {
-	        // for each entry length of key and of value
-	        // plus 2 for separator and newline 
-	        res += pair.first            .length()
-		  + 2 +pair.second.toString().length();
+	        result = native_.b;
+		return true;
 	    }
-	    return res;
-        }
-#endif
-    };
+	    result = equalsIgnoreCase("true");
+	    return result || equalsIgnoreCase("false");
+	}
 
-    /**
-     * Enumeration of error codes which may occur during decoding an ini-file, 
-     * whether as a stream, a string or a file. 
-     */
-    enum DecEncErrorCode
+        template<BlobEncoding ENC>
+        bool tryConvert(t_Blob<ENC> &result) const
+        {
+	    if (tryAsBytes(result.bytes, ENC))
+	        return true;
+	    result.bytes.clear();
+	    return false;
+	}
+
+        template<typename T>
+        bool tryConvert(std::vector<T> &result) const
+        {
+	    return tryAsVector(result).isOk();
+	}
+        static bool isElementBlank(char chr)
+        {
+	    return chr == ' ' || chr == '\t';
+	}
+
+        /**
+	 * Returns the view from \p begin to \p end without leading 
+	 * and trailing blanks. 
+	 */
+        static std::string_view trimElement(const char *begin,
+					    const char *end)
+        {
+	    while (begin != end && isElementBlank(*begin))
+	        begin++;
+	    while (end != begin && isElementBlank(end[-1]))
+	        end--;
+	    return std::string_view(begin, end - begin);
+	}
+
+        /**
+	 * Converts the element starting at \p pos 
+	 * and ending before \p end or at \p delim into \p elem 
+	 * returning whether this succeeded. 
+	 * If so, \p pos is moved to \p end or to the delimiter. 
+	 * Numbers are converted while scanning, 
+	 * other elements are first delimited. 
+	 */
+        template<typename T>
+        static bool parseNextElement(const char *&pos, const char *end,
+				     char delim, T &elem)
+        {
+	    if constexpr (std::is_arithmetic<T>::value
+			  && !std::is_same<T, bool>::value)
+	    {
+	        while (pos != end && isElementBlank(*pos))
+		    pos++;
+		const char *numEnd = pos;
+		if (!parseNumber(pos, end, numEnd, elem))
+		    return false;
+		pos = numEnd;
+		while (pos != end && isElementBlank(*pos))
+		    pos++;
+		return pos == end || *pos == delim;
+	    }
+	    else
+	    {
+	        const char *elemEnd = pos;
+		while (elemEnd != end && *elemEnd != delim)
+		    elemEnd++;
+		bool succ = parseElement(trimElement(pos, elemEnd), elem);
+		pos = elemEnd;
+		return succ;
+	    }
+	}
+
+        /**
+	 * Converts the longest number starting at \p begin 
+	 * and ending before \p end into \p elem 
+	 * and sets \p numEnd to its end, 
+	 * returning whether there is one which is in the range of \p T. 
+	 */
+        template<typename T>
+        static bool parseNumber(const char *begin, const char *end,
+				const char *&numEnd, T &elem)
+        {
+	    if constexpr (std::is_integral<T>::value)
+	    {
+	        std::from_chars_result res = std::from_chars(begin, end, elem);
+		numEnd = res.ptr;
+		return res.ec == std::errc();
+	    }
+	    else
+	    {
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+	        std::from_chars_result res = std::from_chars(begin, end, elem);
+		numEnd = res.ptr;
+		return res.ec == std::errc();
+#else
+		// strtod needs a terminating '\0' 
+		char buf[64];
+		std::size_t len = std::min<std::size_t>(end - begin,
+							sizeof(buf) - 1);
+		memcpy(buf, begin, len);
+		buf[len] = '\0';
+		char *endptr;
+		elem = (T)std::strtod(buf, &endptr);
+		numEnd = begin + (endptr - buf);
+		return endptr != buf;
+#endif
+	    }
+	}
+
+        /**
+	 * Converts the element \p str into \p elem 
+	 * returning whether this succeeded. 
+	 */
+        template<typename T>
+        static bool parseElement(std::string_view str, T &elem)
+        {
+	    if constexpr (std::is_same<T, std::string_view>::value
+			  || std::is_same<T, std::string>::value)
+	    {
+	        elem = T(str);
+		return true;
+	    }
+	    else
+	    {
+	        static_assert(std::is_same<T, bool>::value,
+			      "no conversion of elements into this type");
+	        if (str.size() != 4 && str.size() != 5)
+		    return false;
+		char lower[5];
+		for (std::size_t idx = 0; idx < str.size(); idx++)
+		    lower[idx] = (char)::tolower((unsigned char)str[idx]);
+		elem = std::string_view(lower, str.size()) == "true";
+		return elem || std::string_view(lower, str.size()) == "false";
+	    }
+	}
+    };
+
+    template<class T>
+    class NamedObj
+    {
+      // TBD: change
+    public:
+      std::string first;//key_;
+      T second;//value_;
+      NamedObj(std::string key, T value)
+	: first(std::move(key)), second(std::move(value))
+      {
+      }
+
+      /**
+       * Creates the value in place from \p args. 
+       */
+      template<class... Args>
+      NamedObj(std::string_view key, Args&&... args)
+	: first(key), second(std::forward<Args>(args)...)
+      {
+      }
+      
+    }; // class NamedObj
+
+    /**
+     * A sequence of \p E like a vector 
+     * but stored in chunks which are never moved, 
+     * so that appending keeps references and pointers to the elements valid. 
+     * Iterators still get invalid by appending. 
+     * The first chunk has the capacity requested by #reserve(std::size_t) 
+     * before anything is appended, else #MIN_CAPACITY; 
+     * each further chunk doubles the capacity. 
+     * So the chunk of an index is computed 
+     * and there are only logarithmically many chunks. 
+     */
+    template<class E>
+    class t_ChunkVec
+    {
+    private:
+        static const std::size_t MIN_CAPACITY = 4;
+
+        /**
+	 * The first chunk of storage with capacity #firstCap_ or NULL. 
+	 * Mostly it is the only one, so it is kept apart 
+	 * and accessed without computing the chunk. 
+	 */
+        E *first_;
+        /**
+	 * The further chunks, the i-th with capacity 
+	 * <c>firstCap_ << (i+1)</c>. 
+	 * All chunks but the last one are full. 
+	 */
+        std::vector<E *> further_;
+        // 0 if and only if first_ is NULL 
+        std::size_t firstCap_;
+        std::size_t size_;
+
+        /**
+	 * Returns the element with index \p idx and sets \p chunkEnd 
+	 * to the end of its chunk, 
+	 * or returns NULL if there is no chunk for \p idx. 
+	 */
+        E *locate(std::size_t idx, E *&chunkEnd) const
+        {
+	    if (idx < firstCap_)
+	    {
+	        chunkEnd = first_ + firstCap_;
+		return first_ + idx;
+	    }
+	    chunkEnd = NULL;
+	    if (further_.empty())
+	        return NULL;
+	    // idx is in chunk k if firstCap_*(2^k - 1) <= idx < firstCap_*(2^(k+1) - 1) 
+	    std::size_t quot = idx / firstCap_ + 1;
+	    std::size_t numChunk = 1;
+	    while ((quot >> (numChunk + 1)) != 0)
+	        numChunk++;
+	    if (numChunk > further_.size())
+	        return NULL;
+	    std::size_t cap = firstCap_ << numChunk;
+	    chunkEnd = further_[numChunk - 1] + cap;
+	    return further_[numChunk - 1] + (idx - (cap - firstCap_));
+	}
+
+        std::size_t numChunks() const
+        {
+	    return first_ == NULL ? 0 : further_.size() + 1;
+	}
+
+        /**
+	 * Adds a chunk, if it is the first one with capacity \p firstCap. 
+	 */
+        void addChunk(std::size_t firstCap)
+        {
+	    if (first_ == NULL)
+	    {
+	        first_ = std::allocator<E>().allocate(firstCap);
+		firstCap_ = firstCap;
+		return;
+	    }
+	    further_.push_back(std::allocator<E>()
+			       .allocate(firstCap_ << numChunks()));
+	}
+
+    public:
+        /**
+	 * A random access iterator over a t_ChunkVec 
+	 * with element type \p V, which is \p E or <c>const E</c>. 
+	 * Stepping forward within a chunk is as cheap as for a pointer. 
+	 */
+        template<class V>
+        class t_Iterator
+        {
+	    friend class t_ChunkVec;
+	    template<class W> friend class t_Iterator;
+        private:
+            const t_ChunkVec *vec_;
+            std::size_t idx_;
+            // NULL if idx_ is the size of vec_ and its storage is full 
+            V *ptr_;
+            V *chunkEnd_;
+
+            t_Iterator(const t_ChunkVec *vec, std::size_t idx,
+		       V *ptr, V *chunkEnd)
+	      : vec_(vec), idx_(idx), ptr_(ptr), chunkEnd_(chunkEnd)
+            {}
+
+            void relocate()
+            {
+	        E *chunkEnd;
+	        ptr_ = vec_->locate(idx_, chunkEnd);
+	        chunkEnd_ = chunkEnd;
+	    }
+        public:
+            typedef std::random_access_iterator_tag iterator_category;
+            typedef E value_type;
+            typedef std::ptrdiff_t difference_type;
+            typedef V *pointer;
+            typedef V &reference;
+
+            t_Iterator()
+	      : vec_(NULL), idx_(0), ptr_(NULL), chunkEnd_(NULL)
+            {}
+
+            // also converts an iterator into a const_iterator 
+            t_Iterator(const t_Iterator<E> &other)
+	      : vec_(other.vec_), idx_(other.idx_),
+		ptr_(other.ptr_), chunkEnd_(other.chunkEnd_)
+            {}
+
+            t_Iterator &operator=(const t_Iterator &other) = default;
+
+            V &operator*() const
+            {
+	        return *ptr_;
+	    }
+
+            V *operator->() const
+            {
+	        return ptr_;
+	    }
+
+            t_Iterator &operator++()
+            {
+	        idx_++;
+		if (++ptr_ == chunkEnd_)
+		    relocate();
+		return *this;
+	    }
+
+            t_Iterator operator++(int)
+            {
+	        t_Iterator res = *this;
+		++*this;
+		return res;
+	    }
+
+            t_Iterator &operator--()
+            {
+	        return *this -= 1;
+	    }
+
+            t_Iterator operator--(int)
+            {
+	        t_Iterator res = *this;
+		--*this;
+		return res;
+	    }
+
+            t_Iterator &operator+=(std::ptrdiff_t diff)
+            {
+	        idx_ += diff;
+		relocate();
+		return *this;
+	    }
+
+            t_Iterator &operator-=(std::ptrdiff_t diff)
+            {
+	        return *this += -diff;
+	    }
+
+            t_Iterator operator+(std::ptrdiff_t diff) const
+            {
+	        t_Iterator res = *this;
+		return res += diff;
+	    }
+
+            t_Iterator operator-(std::ptrdiff_t diff) const
+            {
+	        t_Iterator res = *this;
+		return res -= diff;
+	    }
+
+            V &operator[](std::ptrdiff_t diff) const
+            {
+	        return *(*this + diff);
+	    }
+
+            template<class W>
+            std::ptrdiff_t operator-(const t_Iterator<W> &other) const
+            {
+	        return idx_ - other.idx_;
+	    }
+
+            template<class W>
+            bool operator==(const t_Iterator<W> &other) const
+            {
+	        return idx_ == other.idx_;
+	    }
+
+            template<class W>
+            bool operator!=(const t_Iterator<W> &other) const
+            {
+	        return idx_ != other.idx_;
+	    }
+
+            template<class W>
+            bool operator<(const t_Iterator<W> &other) const
+            {
+	        return idx_ < other.idx_;
+	    }
+        }; // class t_Iterator
+
+        typedef t_Iterator<E> iterator;
+        typedef t_Iterator<const E> const_iterator;
+
+        t_ChunkVec()
+	  : first_(NULL), firstCap_(0), size_(0)
+        {}
+
+        t_ChunkVec(const t_ChunkVec &other)
+	  : t_ChunkVec()
+        {
+	    // if copying throws the destructor cleans up 
+	    reserve(other.size_);
+	    for (const E &elem : other)
+	        emplace_back(elem);
+	}
+
+        t_ChunkVec(t_ChunkVec &&other) noexcept
+	  : first_(other.first_),
+	    further_(std::move(other.further_)),
+	    firstCap_(other.firstCap_),
+	    size_(other.size_)
+        {
+	    other.first_ = NULL;
+	    other.further_.clear();
+	    other.firstCap_ = 0;
+	    other.size_ = 0;
+	}
+
+        t_ChunkVec &operator=(const t_ChunkVec &other)
+        {
+	    t_ChunkVec copy(other);
+	    swap(copy);
+	    return *this;
+	}
+
+        t_ChunkVec &operator=(t_ChunkVec &&other) noexcept
+        {
+	    t_ChunkVec moved(std::move(other));
+	    swap(moved);
+	    return *this;
+	}
+
+        ~t_ChunkVec()
+        {
+	    clear();
+	    if (first_ == NULL)
+	        return;
+	    std::allocator<E>().deallocate(first_, firstCap_);
+	    for (std::size_t idx = 0; idx < further_.size(); idx++)
+	        std::allocator<E>().deallocate(further_[idx],
+					       firstCap_ << (idx + 1));
+	}
+
+        void swap(t_ChunkVec &other) noexcept
+        {
+	    std::swap(first_, other.first_);
+	    further_.swap(other.further_);
+	    std::swap(firstCap_, other.firstCap_);
+	    std::swap(size_, other.size_);
+	}
+
+        std::size_t size() const
+        {
+	    return size_;
+	}
+
+        bool empty() const
+        {
+	    return size_ == 0;
+	}
+
+        std::size_t capacity() const
+        {
+	    return firstCap_ * ((std::size_t(1) << numChunks()) - 1);
+	}
+
+        /**
+	 * Ensures capacity for \p num elements without adding chunks later; 
+	 * if nothing was stored yet, exactly \p num. 
+	 */
+        void reserve(std::size_t num)
+        {
+	    while (capacity() < num)
+	        addChunk(num);
+	}
+
+        template<class... Args>
+        E &emplace_back(Args&&... args)
+        {
+	    if (size_ == capacity())
+	        addChunk(MIN_CAPACITY);
+	    E *chunkEnd;
+	    E *elem = new (locate(size_, chunkEnd))
+	        E(std::forward<Args>(args)...);
+	    size_++;
+	    return *elem;
+	}
+
+        E &operator[](std::size_t idx)
+        {
+	    E *chunkEnd;
+	    return *locate(idx, chunkEnd);
+	}
+
+        const E &operator[](std::size_t idx) const
+        {
+	    E *chunkEnd;
+	    return *locate(idx, chunkEnd);
+	}
+
+        E &back()
+        {
+	    return (*this)[size_ - 1];
+	}
+
+        /**
+	 * Destroys all elements but keeps the storage. 
+	 */
+        void clear()
+        {
+	    for (iterator it = begin(); it != end(); it++)
+	        it->~E();
+	    size_ = 0;
+	}
+
+        iterator begin()
+        {
+	    return iterator(this, 0, first_, first_ + firstCap_);
+	}
+
+        // as only the index is compared, the end needs no pointer 
+        iterator end()
+        {
+	    return iterator(this, size_, NULL, NULL);
+	}
+
+        const_iterator begin() const
+        {
+	    return const_cast<t_ChunkVec *>(this)->begin();
+	}
+
+        const_iterator end() const
+        {
+	    return const_iterator(this, size_, NULL, NULL);
+	}
+    }; // class t_ChunkVec
+
+    /**
+     * A map from names to \p T, 
+     * searched linearly and kept in the order of insertion. 
+     * As the entries are stored in a t_ChunkVec, 
+     * references to them stay valid when entries are added. 
+     */
+    template<class T>
+    class t_ResVMap
+    {
+    private:
+        t_ChunkVec<NamedObj<T>> vec_;
+    public:
+        typedef typename t_ChunkVec<NamedObj<T>>::iterator iterator;
+        typedef typename t_ChunkVec<NamedObj<T>>::const_iterator const_iterator;
+      
+        t_ResVMap()
+        {
+        }
+
+        /**
+	 * Returns the value corresponding with \p key if there is one, 
+	 * else appends a new T created with default constructor before.
+	 * Only appending allocates. 
+	 *
+	 * @param key
+	 *    a key in this map. 
+	 */
+        T & operator[](std::string_view key)
+        {
+	   for (iterator it = vec_.begin(); it != vec_.end(); it++)
+	   {
+	       if (it->first == key)
+	       {
+		 return it->second;
+	       }
+	   }
+	   return emplace(key);
+	}
+
+        unsigned int size() const
+        {
+	    return vec_.size();
+        }
+
+        /**
+	 * Appends a new T created with default constructor under \p key 
+	 * which the caller ensures not to be in this map yet. 
+	 */
+        T & append(std::string_view key)
+        {
+	   return emplace(key);
+	}
+
+        /**
+	 * Appends a T created in place from \p args under \p key 
+	 * which the caller ensures not to be in this map yet. 
+	 */
+        template<class... Args>
+        T & emplace(std::string_view key, Args&&... args)
+        {
+	   vec_.emplace_back(key, std::forward<Args>(args)...);
+	   return vec_.back().second;
+	}
+
+        /**
+	 * Reserves space for \p num entries 
+	 * so that appending up to this number does not reallocate. 
+	 */
+        void reserve(std::size_t num)
+        {
+	   vec_.reserve(num);
+	}
+
+        /**
+	 * Returns the entry with key \p key or #end() if there is none. 
+	 */
+        iterator find(std::string_view key)
+        {
+	   for (iterator it = vec_.begin(); it != vec_.end(); it++)
+	   {
+	     if (it->first == key)
+	     {
+	       return it;
+	     }
+	   }
+	   return vec_.end();
+	}
+
+        /**
+	 * Returns the entry with key \p key or #end() if there is none. 
+	 */
+        const_iterator find(std::string_view key) const
+        {
+	   for (const_iterator it = vec_.begin(); it != vec_.end(); it++)
+	   {
+	     if (it->first == key)
+	     {
+	       return it;
+	     }
+	   }
+	   return vec_.end();
+	}
+
+        bool contains(std::string_view key) const
+        {
+	   for (const_iterator it = vec_.begin(); it != vec_.end(); it++)
+	   {
+	     if (it->first == key)
+	     {
+	       return true;
+	     }
+	   }
+	   return false;
+	}
+
+       iterator begin()
+        {
+	 return vec_.begin();
+	}
+
+        iterator end()
+        {
+	    return vec_.end();
+	}
+
+        const_iterator begin() const
+        {
+	    return vec_.begin();
+	}
+
+        const_iterator end() const
+        {
+	    return vec_.end();
+	}
+
+        void clear()
+        {
+	    return vec_.clear();
+        }
+    }; // class t_ResVMap
+
+    /**
+     * A range over a const t_ResVMap with values \p T 
+     * yielding for each entry a \p V created from it, 
+     * e.g. views of its name and value, see IniSection#fields(). 
+     */
+    template<class T, class V>
+    class t_ViewRange
+    {
+    private:
+        const t_ResVMap<T> &map_;
+    public:
+        class iterator
+        {
+        private:
+            typename t_ResVMap<T>::const_iterator it_;
+        public:
+            typedef std::forward_iterator_tag iterator_category;
+            typedef V value_type;
+            typedef std::ptrdiff_t difference_type;
+            typedef void pointer;
+            typedef V reference;
+
+            explicit iterator(typename t_ResVMap<T>::const_iterator it)
+	      : it_(it)
+            {}
+
+            V operator*() const
+            {
+	        return V(*it_);
+	    }
+
+            iterator &operator++()
+            {
+	        ++it_;
+		return *this;
+	    }
+
+            iterator operator++(int)
+            {
+	        iterator res = *this;
+		++it_;
+		return res;
+	    }
+
+            bool operator==(const iterator &other) const
+            {
+	        return it_ == other.it_;
+	    }
+
+            bool operator!=(const iterator &other) const
+            {
+	        return it_ != other.it_;
+	    }
+        }; // class iterator
+
+        explicit t_ViewRange(const t_ResVMap<T> &map)
+	  : map_(map)
+        {}
+
+        iterator begin() const
+        {
+	    return iterator(map_.begin());
+	}
+
+        iterator end() const
+        {
+	    return iterator(map_.end());
+	}
+
+        std::size_t size() const
+        {
+	    return map_.size();
+	}
+    }; // class t_ViewRange
+
+    /**
+     * A field yielded by IniSection#fields(): 
+     * views of its key and of its value as text. 
+     */
+    class FieldView
+    {
+    public:
+        std::string_view key;
+        std::string_view value;
+
+        explicit FieldView(const NamedObj<IniField> &entry) noexcept
+	  : key(entry.first), value(entry.second.view())
+        {}
+    }; // class FieldView
+
+
+    class IniSection
+    {
+    public:// TBD: later make private again 
+        t_ResVMap<IniField> map;
+    public:
+        IniSection()
+        {}
+        // noexcept moves as for IniField 
+        IniSection(const IniSection &) = default;
+        IniSection(IniSection &&) noexcept = default;
+        IniSection &operator=(const IniSection &) = default;
+        IniSection &operator=(IniSection &&) noexcept = default;
+        ~IniSection()
+        {}
+
+        IniField & operator[](std::string_view key)
+        {
+	    return map[key];
+	}
+
+        /**
+	 * Returns the field with key \p key or NULL if there is none. 
+	 * Unlike #operator[](std::string_view) this does not insert anything 
+	 * and does not allocate. 
+	 */
+        const IniField *find(std::string_view key) const
+        {
+	    t_ResVMap<IniField>::const_iterator found = map.find(key);
+	    return found == map.end() ? NULL : &found->second;
+	}
+
+        /**
+	 * Returns the value of the field with key \p key as a \p T 
+	 * or \p defaultValue if there is no such field 
+	 * or if it is no \p T. 
+	 * This does neither insert anything nor allocate on a miss 
+	 * and, unlike IniField#orDefault(T), 
+	 * does not modify the field, so it may run concurrently. 
+	 */
+        template<typename T>
+        T get(std::string_view key, T defaultValue) const
+        {
+	    const IniField *field = find(key);
+	    T value;
+	    if (field == NULL || !field->tryConvert(value))
+	        return defaultValue;
+	    return value;
+	}
+
+        // TBD: in the long run this shall be removed:
+        // this method is not used in application, but for testing. 
+        // In a validating parser, only a bool valued check is necessary. 
+        unsigned int size() const
+        {
+	    return map.size();
+        }
+
+        /**
+	 * Returns a range over the fields in the order of insertion 
+	 * yielding FieldViews, i.e. views of keys and values 
+	 * without copying any of them: 
+	 * <c>for (ini::FieldView field : section.fields())</c>. 
+	 */
+        t_ViewRange<IniField, FieldView> fields() const
+        {
+	    return t_ViewRange<IniField, FieldView>(map);
+	}
+
+        unsigned int lengthText() const
+        {
+	    unsigned int res = 0;
+	    for (const auto &pair : map)
+	    {
+	        // for each entry length of key and of value
+	        // plus 2 for separator and newline 
+	        res += pair.first            .length()
+		  + 2 +pair.second.view().length();
+	    }
+	    return res;
+        }
+    };
+
+    /**
+     * A section yielded by IniFile#sections(): 
+     * a view of its name and the section itself. 
+     */
+    class SectionView
+    {
+    public:
+        std::string_view name;
+        const IniSection &section;
+
+        explicit SectionView(const NamedObj<IniSection> &entry) noexcept
+	  : name(entry.first), section(entry.second)
+        {}
+    }; // class SectionView
+
+    /**
+     * Enumeration of error codes which may occur during decoding an ini-file, 
+     * whether as a stream, a string or a file. 
+     */
+    enum DecEncErrorCode
+    {
+        // indicates that encoding/decoding finished without failure 
+        NO_FAILURE = 0,
+	// indicates that a section was not closed,
+	// i.e. a line started with '[' but had no according ']'
+	// in the course of decoding. 
+	SECTION_NOT_CLOSED,
+	// indicates that a section name was empty,
+	// i.e. a line started with '[]'
+	// in the course of decoding. 
+	SECTION_NAME_EMPTY,
+	// indicates that in a line defining a section there was text after ']'
+	// i.e. ']' was not immediately followed by '\n' 
+	// in the course of decoding. 
+	SECTION_TEXT_AFTER,
+	// indicates that a section name occurred more than once
+	// in the course of decoding. 
+	SECTION_NOT_UNIQUE,
+	// Indicates at the moment
+	// that one more section is found than specified.
+	// TBD: In the long run, this can also indicate
+	// that the name of the section does not fit the grammar. 
+	SECTION_UNEXPECTED,
+	// indicates that during decoding an illegal line was found,
+	// i.e. a line which is neither empty, 
+	// (nor a comment lineby default starting with '#') 
+	// nor a section line (starting with '[')
+	// nor a key-value-line (containing by default '=').
+	ILLEGAL_LINE,
+	// indicates that during decoding a field was found 
+	// without preceeding section 
+	FIELD_WITHOUT_SECTION,
+	// indicates that during decoding a field was found 
+	// with a key which is not unique within its section. 
+	FIELD_NOT_UNIQUE_IN_SECTION,
+	// Indicates at the moment,
+	// that one more field is found in the section as specified.
+	// TBD: In the long run, this can also indicate,
+	// that the name of the field does not fit the grammar. 
+	FIELD_UNEXPECTED_IN_SECTION,
+	
+	// TBD: occurs during decoding
+	// of file streams only, not for string streams
+	// if trying to open file which does not exist, or is not readable
+	// or if a directory in windows, even if readable flag set. 
+	STREAM_OPENR_FAILED,
+	// TBD: occurs during encoding
+	// for file streams only, not for string streams
+	// if trying to open file which does not exist, or is not writable 
+	STREAM_OPENW_FAILED,
+	// during decoding if
+	// trying to read from a directory which is readable on linux
+	// maybe other cases 
+	STREAM_READ_FAILED,
+	// during encoding if trying to write to directory which is writable 
+	// maybe other cases 
+	STREAM_WRITE_FAILED,
+
+	// codes added later are appended 
+	// so that the values of the ones above do not change 
+
+	// indicates that during decoding into a struct 
+	// the value of a field could not be converted 
+	// into the type of the member it is bound to. 
+	FIELD_CONVERSION_FAILED,
+	// indicates that a field requested by IniFile#extract() 
+	// was not found, either the section or the key within it. 
+	FIELD_NOT_FOUND,
+	// indicates that during decoding a file included itself, 
+	// directly or via other included files. 
+	INCLUDE_CYCLIC,
+	// indicates that IniFile#loadAll or IniFile#saveAll 
+	// got fewer IniFiles than file names, 
+	// for each file name without IniFile. 
+	INI_FILE_MISSING,
+	// indicates that IniFile#loadAll or IniFile#saveAll 
+	// caught an exception loading or saving a file, 
+	// e.g. std::bad_alloc. 
+	EXCEPTION_CAUGHT
+    };
+
+#ifdef DEC_ENC_STATISTICS_ENABLED
+    /**
+     * Returns the number of allocations so far 
+     * if installed by the application, e.g. from a replaced operator new. 
+     * If this is <c>NULL</c>, 
+     * DecEncStatistics#getNumAllocations() is always 0. 
+     */
+    inline std::size_t (*allocationCounter)() = NULL;
+
+    /**
+     * Statistics of one decode or encode 
+     * as returned by IniFile::DecEncResult#getStatistics(). 
+     * Recorded only if DEC_ENC_STATISTICS_ENABLED is defined; 
+     * else this class does not exist and recording costs nothing. 
+     * Lines are the lines delivered by the stream, 
+     * bytes are their lengths each including the newline. 
+     * If decoding fails, the numbers refer to the part up to the failure. 
+     */
+    class DecEncStatistics
+    {
+      template<class Dialect> friend class t_IniFile;
+    private:
+        std::size_t numBytes_ = 0;
+        unsigned int numLines_ = 0;
+        unsigned int numSections_ = 0;
+        unsigned int numFields_ = 0;
+        unsigned int numComments_ = 0;
+        std::size_t maxLineLength_ = 0;
+        std::size_t numAllocations_ = 0;
+        std::chrono::nanoseconds ioTime_ = std::chrono::nanoseconds::zero();
+        std::chrono::nanoseconds scanTime_ = std::chrono::nanoseconds::zero();
+        std::chrono::nanoseconds insertTime_ = std::chrono::nanoseconds::zero();
+
+    public:
+        std::size_t getNumBytes() const
+        {
+            return numBytes_;
+        }
+        unsigned int getNumLines() const
+        {
+            return numLines_;
+        }
+        unsigned int getNumSections() const
+        {
+            return numSections_;
+        }
+        unsigned int getNumFields() const
+        {
+            return numFields_;
+        }
+        // comment lines, decode only 
+        unsigned int getNumComments() const
+        {
+            return numComments_;
+        }
+        std::size_t getMaxLineLength() const
+        {
+            return maxLineLength_;
+        }
+        // see #allocationCounter 
+        std::size_t getNumAllocations() const
+        {
+            return numAllocations_;
+        }
+        /**
+	 * Returns the time spent reading lines from 
+	 * or writing lines to the stream. 
+	 */
+        std::chrono::nanoseconds getIoTime() const
+        {
+            return ioTime_;
+        }
+        /**
+	 * Returns the time spent neither in I/O nor in inserting, 
+	 * i.e. scanning lines when decoding 
+	 * and converting values to strings when encoding. 
+	 */
+        std::chrono::nanoseconds getScanTime() const
+        {
+            return scanTime_;
+        }
+        /**
+	 * Returns the time spent inserting sections and fields found, 
+	 * in the map or in a bound struct. 
+	 * This is 0 for encoding. 
+	 */
+        std::chrono::nanoseconds getInsertTime() const
+        {
+            return insertTime_;
+        }
+    }; // class DecEncStatistics
+#endif
+
+#ifdef IO_URING_ENABLED
+    /**
+     * A minimal io_uring on raw system calls, i.e. without liburing, 
+     * reading and writing many files in batches 
+     * with a few system calls per batch 
+     * instead of several per file. 
+     * Used by IniFile#loadAll and IniFile#saveAll 
+     * which fall back to streams 
+     * if the kernel does not provide io_uring or the operations needed. 
+     */
+    class IoUring
+    {
+    private:
+        // files per batch, each needing at most 2 entries per round 
+        static const unsigned int BATCH_SIZE = 128;
+        static const unsigned int NUM_ENTRIES = 2*BATCH_SIZE;
+        // the most a single read or write transfers 
+        static constexpr std::size_t MAX_LEN_RW = 0x7ffff000;
+
+        int fd_;
+        void *sqRing_;
+        std::size_t sqRingSize_;
+        void *cqRing_;
+        std::size_t cqRingSize_;
+        io_uring_sqe *sqes_;
+        std::size_t sqesSize_;
+        unsigned int *sqTail_;
+        unsigned int *sqMask_;
+        unsigned int *sqArray_;
+        unsigned int *cqHead_;
+        unsigned int *cqTail_;
+        unsigned int *cqMask_;
+        io_uring_cqe *cqes_;
+        // entries filled but not yet submitted 
+        unsigned int numPending_;
+
+        /**
+	 * Returns whether the kernel supports all operations needed. 
+	 */
+        bool probe()
+        {
+            const unsigned int numOps = 256;
+            std::vector<char> buff(sizeof(io_uring_probe)
+                                   + numOps*sizeof(io_uring_probe_op), 0);
+            io_uring_probe *prb = reinterpret_cast<io_uring_probe *>(buff.data());
+            if (syscall(__NR_io_uring_register, fd_, IORING_REGISTER_PROBE,
+                        prb, numOps) < 0)
+                return false;
+            for (unsigned int op : {IORING_OP_OPENAT, IORING_OP_STATX,
+                                    IORING_OP_READ, IORING_OP_WRITE,
+                                    IORING_OP_CLOSE})
+            {
+                if (op > prb->last_op
+                    || (prb->ops[op].flags & IO_URING_OP_SUPPORTED) == 0)
+                    return false;
+            }
+            return true;
+        }
+
+        void queue(__u8 opcode, int fd, const void *addr, __u32 len,
+                   __u64 off, __u32 flags, __u64 userData)
+        {
+            unsigned int tail = *sqTail_ + numPending_;
+            unsigned int idx = tail & *sqMask_;
+            io_uring_sqe *sqe = &sqes_[idx];
+            memset(sqe, 0, sizeof(*sqe));
+            sqe->opcode = opcode;
+            sqe->fd = fd;
+            sqe->addr = (__u64)(uintptr_t)addr;
+            sqe->len = len;
+            sqe->off = off;
+            // open_flags, statx_flags and rw_flags share this place 
+            sqe->open_flags = flags;
+            sqe->user_data = userData;
+            sqArray_[idx] = idx;
+            numPending_++;
+        }
+
+        /**
+	 * Submits all entries queued, waits for their completions 
+	 * and hands each over to \p onCompletion(userData, res). 
+	 * Returns false if the ring itself fails. 
+	 */
+        template<class F>
+        bool submitAndWait(F onCompletion)
+        {
+            unsigned int numToSubmit = numPending_;
+            unsigned int numToComplete = numPending_;
+            __atomic_store_n(sqTail_, *sqTail_ + numPending_, __ATOMIC_RELEASE);
+            numPending_ = 0;
+            while (numToComplete != 0)
+            {
+                long res = syscall(__NR_io_uring_enter, fd_,
+                                   numToSubmit, 1, IORING_ENTER_GETEVENTS,
+                                   NULL, 0);
+                if (res < 0)
+                {
+                    if (errno == EINTR)
+                        continue;
+                    return false;
+                }
+                numToSubmit -= (unsigned int)res;
+                unsigned int head = *cqHead_;
+                unsigned int tail = __atomic_load_n(cqTail_, __ATOMIC_ACQUIRE);
+                for (; head != tail; head++)
+                {
+                    const io_uring_cqe &cqe = cqes_[head & *cqMask_];
+                    onCompletion(cqe.user_data, cqe.res);
+                    numToComplete--;
+                }
+                __atomic_store_n(cqHead_, head, __ATOMIC_RELEASE);
+            }
+            return true;
+        }
+
+        /**
+	 * Closes the first \p num files in \p fds still open 
+	 * directly instead of via the ring 
+	 * before giving up as the ring failed. 
+	 */
+        static void closeFiles(std::vector<int> &fds, unsigned int num)
+        {
+            for (unsigned int idx = 0; idx < num; idx++)
+            {
+                if (fds[idx] >= 0)
+                    close(fds[idx]);
+                fds[idx] = -1;
+            }
+        }
+
+        /**
+	 * Closes the first \p num files in \p fds in one round 
+	 * handing the result of each over to \p onClosed(idx, res). 
+	 * Returns false if the ring fails, 
+	 * then closing the files not yet closed directly. 
+	 */
+        template<class F>
+        bool closeFiles(std::vector<int> &fds, unsigned int num, F onClosed)
+        {
+            for (unsigned int idx = 0; idx < num; idx++)
+            {
+                if (fds[idx] >= 0)
+                    queue(IORING_OP_CLOSE, fds[idx], NULL, 0, 0, 0, idx);
+            }
+            bool ok = submitAndWait([&](__u64 idx, int res)
+                {
+                    fds[idx] = -1;
+                    onClosed(idx, res);
+                });
+            if (!ok)
+                closeFiles(fds, num);
+            return ok;
+        }
+
+    public:
+        IoUring()
+          : fd_(-1), sqRing_(MAP_FAILED), sqRingSize_(0),
+            cqRing_(MAP_FAILED), cqRingSize_(0),
+            sqes_((io_uring_sqe *)MAP_FAILED), sqesSize_(0),
+            numPending_(0)
+        {
+            io_uring_params params;
+            memset(&params, 0, sizeof(params));
+            fd_ = (int)syscall(__NR_io_uring_setup, NUM_ENTRIES, &params);
+            if (fd_ < 0)
+                return;
+            sqRingSize_ = params.sq_off.array
+                + params.sq_entries*sizeof(unsigned int);
+            cqRingSize_ = params.cq_off.cqes
+                + params.cq_entries*sizeof(io_uring_cqe);
+            bool singleMmap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+            if (singleMmap)
+                sqRingSize_ = cqRingSize_ = std::max(sqRingSize_, cqRingSize_);
+            sqRing_ = mmap(NULL, sqRingSize_, PROT_READ | PROT_WRITE,
+                           MAP_SHARED | MAP_POPULATE, fd_, IORING_OFF_SQ_RING);
+            if (sqRing_ == MAP_FAILED)
+                return;
+            if (singleMmap)
+                cqRing_ = sqRing_;
+            else
+                cqRing_ = mmap(NULL, cqRingSize_, PROT_READ | PROT_WRITE,
+                               MAP_SHARED | MAP_POPULATE, fd_, IORING_OFF_CQ_RING);
+            if (cqRing_ == MAP_FAILED)
+                return;
+            sqesSize_ = params.sq_entries*sizeof(io_uring_sqe);
+            sqes_ = (io_uring_sqe *)mmap(NULL, sqesSize_, PROT_READ | PROT_WRITE,
+                                         MAP_SHARED | MAP_POPULATE,
+                                         fd_, IORING_OFF_SQES);
+            if (sqes_ == MAP_FAILED)
+                return;
+            char *sq = (char *)sqRing_;
+            sqTail_  = (unsigned int *)(sq + params.sq_off.tail);
+            sqMask_  = (unsigned int *)(sq + params.sq_off.ring_mask);
+            sqArray_ = (unsigned int *)(sq + params.sq_off.array);
+            char *cq = (char *)cqRing_;
+            cqHead_  = (unsigned int *)(cq + params.cq_off.head);
+            cqTail_  = (unsigned int *)(cq + params.cq_off.tail);
+            cqMask_  = (unsigned int *)(cq + params.cq_off.ring_mask);
+            cqes_    = (io_uring_cqe *)(cq + params.cq_off.cqes);
+        }
+
+        ~IoUring()
+        {
+            if (sqes_ != MAP_FAILED)
+                munmap(sqes_, sqesSize_);
+            if (cqRing_ != MAP_FAILED && cqRing_ != sqRing_)
+                munmap(cqRing_, cqRingSize_);
+            if (sqRing_ != MAP_FAILED)
+                munmap(sqRing_, sqRingSize_);
+            if (fd_ >= 0)
+                close(fd_);
+        }
+
+        /**
+	 * Returns whether this ring can be used; 
+	 * if not, the caller shall fall back to streams. 
+	 */
+        bool isOpen()
+        {
+            return fd_ >= 0 && sqes_ != MAP_FAILED && probe();
+        }
+
+        /**
+	 * Reads the files \p fileNames into \p contents 
+	 * setting \p errorCodes to DecEncErrorCode#NO_FAILURE, 
+	 * DecEncErrorCode#STREAM_OPENR_FAILED 
+	 * or DecEncErrorCode#STREAM_READ_FAILED. 
+	 * Per batch, files are opened and their sizes determined in one round, 
+	 * read in a second unless reads are short and closed in a third. 
+	 * Files which change size meanwhile are reported in \p reread 
+	 * to be read by other means. 
+	 * Returns false if the ring fails. 
+	 */
+        bool readFiles(const std::vector<std::string> &fileNames,
+                       std::vector<std::string> &contents,
+                       std::vector<DecEncErrorCode> &errorCodes,
+                       std::vector<std::size_t> &reread)
+        {
+            std::size_t numFiles = fileNames.size();
+            contents.resize(numFiles);
+            errorCodes.assign(numFiles, NO_FAILURE);
+            std::vector<int> fds(BATCH_SIZE);
+            std::vector<struct statx> stats(BATCH_SIZE);
+            std::vector<bool> sized(BATCH_SIZE);
+            // the number of bytes read so far and whether reading is done 
+            std::vector<std::size_t> numRead(BATCH_SIZE);
+            std::vector<bool> done(BATCH_SIZE);
+            for (std::size_t start = 0; start < numFiles; start += BATCH_SIZE)
+            {
+                unsigned int num =
+                    (unsigned int)std::min<std::size_t>(BATCH_SIZE, numFiles - start);
+                // open and determine size 
+                for (unsigned int idx = 0; idx < num; idx++)
+                {
+                    const char *name = fileNames[start + idx].c_str();
+                    fds[idx] = -1;
+                    sized[idx] = false;
+                    queue(IORING_OP_OPENAT, AT_FDCWD, name, 0, 0,
+                          O_RDONLY | O_CLOEXEC, 2*idx);
+                    queue(IORING_OP_STATX, AT_FDCWD, name, STATX_SIZE,
+                          (__u64)(uintptr_t)&stats[idx], 0, 2*idx + 1);
+                }
+                bool ok = submitAndWait([&](__u64 data, int res)
+                    {
+                        unsigned int idx = (unsigned int)(data/2);
+                        if (data % 2 == 0)
+                        {
+                            if (res < 0)
+                                errorCodes[start + idx] = STREAM_OPENR_FAILED;
+                            else
+                                fds[idx] = res;
+                        }
+                        else
+                            sized[idx] = res >= 0;
+                    });
+                if (!ok)
+                {
+                    closeFiles(fds, num);
+                    return false;
+                }
+
+                // read one more byte than expected to detect growth 
+                for (unsigned int idx = 0; idx < num; idx++)
+                {
+                    numRead[idx] = 0;
+                    done[idx] = fds[idx] < 0 || !sized[idx];
+                    if (!done[idx])
+                        contents[start + idx].resize(stats[idx].stx_size + 1);
+                }
+                // repeated for short reads 
+                for (;;)
+                {
+                    for (unsigned int idx = 0; idx < num; idx++)
+                    {
+                        if (done[idx])
+                            continue;
+                        std::string &content = contents[start + idx];
+                        queue(IORING_OP_READ, fds[idx], &content[numRead[idx]],
+                              (__u32)std::min(content.size() - numRead[idx],
+                                              MAX_LEN_RW),
+                              numRead[idx], 0, idx);
+                    }
+                    if (numPending_ == 0)
+                        break;
+                    ok = submitAndWait([&](__u64 idx, int res)
+                        {
+                            if (res < 0)
+                                errorCodes[start + idx] = STREAM_READ_FAILED;
+                            else
+                                numRead[idx] += res;
+                            // at the end, on failure or if grown 
+                            done[idx] = res <= 0
+                                || numRead[idx] == contents[start + idx].size();
+                        });
+                    if (!ok)
+                    {
+                        closeFiles(fds, num);
+                        return false;
+                    }
+                }
+                for (unsigned int idx = 0; idx < num; idx++)
+                {
+                    if (fds[idx] < 0)
+                        continue;
+                    std::string &content = contents[start + idx];
+                    if (errorCodes[start + idx] != NO_FAILURE)
+                        content.clear();
+                    else if (sized[idx] && numRead[idx] + 1 == content.size())
+                        content.resize(numRead[idx]);
+                    else
+                        reread.push_back(start + idx);
+                }
+
+                if (!closeFiles(fds, num, [](__u64, int) {}))
+                    return false;
+            }
+            return true;
+        }
+
+        /**
+	 * Writes \p contents into the files \p fileNames 
+	 * replacing former contents, 
+	 * setting \p errorCodes to DecEncErrorCode#NO_FAILURE, 
+	 * DecEncErrorCode#STREAM_OPENW_FAILED 
+	 * or DecEncErrorCode#STREAM_WRITE_FAILED. 
+	 * Per batch, files are opened in one round, 
+	 * written in one round unless writes are short, 
+	 * and closed in one round. 
+	 * Returns false if the ring fails. 
+	 */
+        bool writeFiles(const std::vector<std::string> &fileNames,
+                        const std::vector<std::string> &contents,
+                        std::vector<DecEncErrorCode> &errorCodes)
+        {
+            std::size_t numFiles = fileNames.size();
+            errorCodes.assign(numFiles, NO_FAILURE);
+            std::vector<int> fds(BATCH_SIZE);
+            std::vector<std::size_t> written(BATCH_SIZE);
+            for (std::size_t start = 0; start < numFiles; start += BATCH_SIZE)
+            {
+                unsigned int num =
+                    (unsigned int)std::min<std::size_t>(BATCH_SIZE, numFiles - start);
+                for (unsigned int idx = 0; idx < num; idx++)
+                {
+                    fds[idx] = -1;
+                    written[idx] = 0;
+                    queue(IORING_OP_OPENAT, AT_FDCWD, fileNames[start + idx].c_str(),
+                          0666, 0, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, idx);
+                }
+                bool ok = submitAndWait([&](__u64 idx, int res)
+                    {
+                        if (res < 0)
+                            errorCodes[start + idx] = STREAM_OPENW_FAILED;
+                        else
+                            fds[idx] = res;
+                    });
+                if (!ok)
+                {
+                    closeFiles(fds, num);
+                    return false;
+                }
+
+                // repeated for short writes 
+                for (bool pending = true; pending; )
+                {
+                    for (unsigned int idx = 0; idx < num; idx++)
+                    {
+                        const std::string &content = contents[start + idx];
+                        if (fds[idx] < 0 || errorCodes[start + idx] != NO_FAILURE
+                            || written[idx] == content.size())
+                            continue;
+                        queue(IORING_OP_WRITE, fds[idx],
+                              content.data() + written[idx],
+                              (__u32)std::min(content.size() - written[idx],
+                                              MAX_LEN_RW),
+                              written[idx], 0, idx);
+                    }
+                    pending = numPending_ != 0;
+                    if (!pending)
+                        break;
+                    ok = submitAndWait([&](__u64 idx, int res)
+                        {
+                            if (res <= 0)
+                                errorCodes[start + idx] = STREAM_WRITE_FAILED;
+                            else
+                                written[idx] += res;
+                        });
+                    if (!ok)
+                    {
+                        closeFiles(fds, num);
+                        return false;
+                    }
+                }
+
+                ok = closeFiles(fds, num, [&](__u64 idx, int res)
+                    {
+                        if (res < 0)
+                            errorCodes[start + idx] = STREAM_WRITE_FAILED;
+                    });
+                if (!ok)
+                    return false;
+            }
+            return true;
+        }
+    }; // class IoUring
+#endif
+
+    // class LightweightMap
+    // {
+    // };
+
+    /**
+     * Describes one field to be extracted by IniFile#extract(): 
+     * the section and the key and the destination 
+     * together with the conversion into the type of the destination. 
+     * Create instances with 
+     * #extractItem(std::string_view, std::string_view, T&, const T&). 
+     * Section and key are views 
+     * which must stay valid until extraction is done. 
+     */
+    class ExtractItem
+    {
+    public:
+        std::string_view section;
+        std::string_view key;
+        void *dest;
+        /**
+	 * Converts the field given into the type of #dest 
+	 * and writes it into #dest if possible. 
+	 * Returns whether conversion succeeded. 
+	 */
+        bool (*convert)(const IniField &field, void *dest);
+    }; // class ExtractItem
+
+    template<class T>
+    bool convertExtractItem(const IniField &field, void *dest)
+    {
+        T result = field.asUnconditional<T>();
+        if (field.failedLastOutConversion())
+            return false;
+        *static_cast<T *>(dest) = result;
+        return true;
+    }
+
+    /**
+     * Returns an item for IniFile#extract() 
+     * writing the field with key \p key in section \p section 
+     * converted into \p T into \p dest. 
+     * As \p dest is set to \p defaultValue here, 
+     * it holds the default if the field is missing or malformed. 
+     */
+    template<class T>
+    ExtractItem extractItem(std::string_view section,
+                            std::string_view key,
+                            T &dest,
+                            const T &defaultValue)
+    {
+        static_assert(!std::is_pointer<T>::value,
+                      "a pointer into a field may dangle");
+        dest = defaultValue;
+        return ExtractItem{section, key, &dest, &convertExtractItem<T>};
+    }
+
+    /**
+     * A failure of IniFile#extract() for one item: 
+     * DecEncErrorCode#FIELD_NOT_FOUND or 
+     * DecEncErrorCode#FIELD_CONVERSION_FAILED. 
+     */
+    class ExtractFailure
+    {
+    public:
+        /**
+	 * The index of the item which failed. 
+	 */
+        std::size_t index;
+        DecEncErrorCode errorCode;
+    }; // class ExtractFailure
+
+    /**
+     * The result of IniFile#extract(): 
+     * all failures ordered by the indices of the items. 
+     */
+    class ExtractResult
+    {
+	template<class Dialect> friend class t_IniFile;
+    private:
+        std::vector<ExtractFailure> failures_;
+    public:
+        bool isOk() const
+        {
+            return failures_.empty();
+        }
+
+        const std::vector<ExtractFailure> &getFailures() const
+        {
+            return failures_;
+        }
+    }; // class ExtractResult
+
+    /**
+     * A field of an IniFile resolved once by IniFile#resolve() 
+     * to be accessed by IniFile#tryAt() or IniFile#at() 
+     * by position without comparing any names. 
+     * It records the generation of the IniFile 
+     * so that it is detected to be stale 
+     * once the sections are replaced, e.g. by decoding or assigning, 
+     * and if used with another IniFile. 
+     * Appending sections and fields keeps it valid. 
+     */
+    class FieldHandle
+    {
+	template<class Dialect> friend class t_IniFile;
+    private:
+        std::uint32_t idxSec_ = 0;
+        std::uint32_t idxField_ = 0;
+        /**
+	 * The generation of the IniFile when resolving 
+	 * or 0 if resolving failed. 
+	 */
+        std::uint64_t generation_ = 0;
+
+        /**
+	 * Returns a generation not returned before in this process, 
+	 * so that no two IniFiles ever share a generation. 
+	 */
+        static std::uint64_t nextGeneration()
+        {
+#ifdef THREADS_PREVENTED
+            static std::uint64_t next = 1;
+#else
+            static std::atomic<std::uint64_t> next(1);
+#endif
+            return next++;
+        }
+    public:
+        /**
+	 * Returns whether resolving found the field. 
+	 * This does not mean the handle is still current. 
+	 */
+        bool isResolved() const
+        {
+            return generation_ != 0;
+        }
+    }; // class FieldHandle
+
+    /**
+     * Signals that decoding an ini-file by #parseStatic 
+     * failed with DecEncErrorCode \p C in line \p lineNumber. 
+     * As this is not constexpr, reaching it at compile time 
+     * is a compile error naming \p C. 
+     * If reached at runtime it throws a logic_error 
+     * or aborts if THROW_PREVENTED is set. 
+     */
+    template<DecEncErrorCode C>
+    void staticDecodingFailed(std::size_t lineNumber)
+    {
+#ifdef THROW_PREVENTED
+        (void)lineNumber;
+        abort();
+#else
+        throw std::logic_error("in line " + std::to_string(lineNumber)
+                               + ": static ini parsing failed with code "
+                               + std::to_string(C));
+#endif
+    }
+
+    /**
+     * Returns \p str without leading and trailing blanks and tabs, 
+     * i.e. what IniFile#trim(std::string&) does, but constexpr. 
+     */
+    constexpr std::string_view trimStatic(std::string_view str)
+    {
+        std::size_t startpos = str.find_first_not_of(" \t");
+        if (startpos == std::string_view::npos)
+            return std::string_view();
+        std::size_t endpos = str.find_last_not_of(" \t");
+        return str.substr(startpos, endpos - startpos + 1);
+    }
+
+    /**
+     * Returns the number of sections in \p text 
+     * which is the minimal first template parameter 
+     * of #parseStatic(std::string_view, char, char). 
+     */
+    constexpr std::size_t countStaticSections(std::string_view text)
+    {
+        std::size_t res = 0;
+        for (std::size_t pos = 0; pos <= text.size(); pos++)
+        {
+            std::size_t end = text.find('\n', pos);
+            if (end == std::string_view::npos)
+                end = text.size();
+            std::string_view line = trimStatic(text.substr(pos, end - pos));
+            if (!line.empty() && line[0] == '[')
+                res++;
+            pos = end;
+        }
+        return res;
+    }
+
+    /**
+     * Returns the number of fields in \p text 
+     * which is the minimal second template parameter 
+     * of #parseStatic(std::string_view, char, char). 
+     */
+    constexpr std::size_t countStaticFields(std::string_view text,
+                                            char fieldSep = '=',
+                                            char comment = '#')
+    {
+        std::size_t res = 0;
+        for (std::size_t pos = 0; pos <= text.size(); pos++)
+        {
+            std::size_t end = text.find('\n', pos);
+            if (end == std::string_view::npos)
+                end = text.size();
+            std::string_view line = trimStatic(text.substr(pos, end - pos));
+            if (!line.empty() && line[0] != '[' && line[0] != comment
+                && line.find(fieldSep) != std::string_view::npos)
+                res++;
+            pos = end;
+        }
+        return res;
+    }
+
+    /**
+     * A field of a t_StaticIni: 
+     * all parts are views into the text decoded. 
+     */
+    class StaticIniField
+    {
+    public:
+        std::string_view section;
+        std::string_view key;
+        std::string_view value;
+    }; // class StaticIniField
+
+    /**
+     * An ini-file decoded at compile time by #parseStatic 
+     * into fixed size tables of at most \p NUM_SECTIONS sections 
+     * and at most \p NUM_FIELDS fields without any heap memory. 
+     * Fields are found by a perfect hash built at compile time 
+     * (hash and displace): each pair of section and key 
+     * is hashed into one of #NUM_BUCKETS buckets 
+     * and the displacement of that bucket 
+     * leads to a slot of its own in #slots_. 
+     * Thus a lookup costs two hashes and one comparison; 
+     * if done in a constant expression it costs nothing at runtime. 
+     * The grammar is the one of IniFile#tryDecode(InStreamInterface&) 
+     * and failures are compile errors. 
+     */
+    template<std::size_t NUM_SECTIONS, std::size_t NUM_FIELDS>
+    class t_StaticIni
+    {
+    private:
+        static constexpr std::size_t nextPow2(std::size_t num)
+        {
+            std::size_t res = 1;
+            while (res < num)
+                res *= 2;
+            return res;
+        }
+
+    public:
+        static constexpr std::size_t NUM_BUCKETS = nextPow2(NUM_FIELDS);
+        static constexpr std::size_t NUM_SLOTS   = nextPow2(2 * NUM_FIELDS);
+
+    private:
+        std::array<std::string_view, NUM_SECTIONS> sections_{};
+        std::array<StaticIniField, NUM_FIELDS> fields_{};
+        std::size_t numSections_ = 0;
+        std::size_t numFields_   = 0;
+        std::array<std::uint32_t, NUM_BUCKETS> displacements_{};
+        // for each slot the index of its field plus 1 or 0 if free 
+        std::array<std::size_t, NUM_SLOTS> slots_{};
+
+        static constexpr std::uint32_t hashField(std::uint32_t seed,
+                                                 std::string_view section,
+                                                 std::string_view key)
+        {
+            std::uint32_t hash = 2166136261u ^ (seed * 0x9E3779B9u);
+            for (char ch : section)
+            {
+                hash ^= (unsigned char)ch;
+                hash *= 16777619u;
+            }
+            // separates section from key 
+            hash *= 16777619u;
+            for (char ch : key)
+            {
+                hash ^= (unsigned char)ch;
+                hash *= 16777619u;
+            }
+            // final mix so that the low bits depend on all bits 
+            hash ^= hash >> 16;
+            hash *= 0x85ebca6bu;
+            hash ^= hash >> 13;
+            hash *= 0xc2b2ae35u;
+            hash ^= hash >> 16;
+            return hash;
+        }
+
+        static constexpr std::size_t bucketOf(std::string_view section,
+                                              std::string_view key)
+        {
+            return hashField(0, section, key) & (NUM_BUCKETS - 1);
+        }
+
+        static constexpr std::size_t slotOf(std::uint32_t displacement,
+                                            std::string_view section,
+                                            std::string_view key)
+        {
+            return hashField(displacement, section, key) & (NUM_SLOTS - 1);
+        }
+
+        constexpr void decode(std::string_view text, char fieldSep, char comment)
+        {
+            std::string_view section;
+            bool inSection = false;
+            std::size_t lineNumber = 0;
+            for (std::size_t pos = 0; pos <= text.size(); pos++)
+            {
+                lineNumber++;
+                std::size_t end = text.find('\n', pos);
+                if (end == std::string_view::npos)
+                    end = text.size();
+                std::string_view line = text.substr(pos, end - pos);
+                pos = end;
+                // lines may also end with \r\n 
+                if (!line.empty() && line[line.size() - 1] == '\r')
+                    line.remove_suffix(1);
+                line = trimStatic(line);
+
+                // skip if line is empty or a comment
+                if (line.empty() || line[0] == comment)
+                    continue;
+
+                if (line[0] == '[')
+                {
+                    std::size_t secEnd = line.find(']');
+                    if (secEnd == std::string_view::npos)
+                        staticDecodingFailed<SECTION_NOT_CLOSED>(lineNumber);
+                    if (secEnd == 1)
+                        staticDecodingFailed<SECTION_NAME_EMPTY>(lineNumber);
+                    if (secEnd + 1 != line.size())
+                        staticDecodingFailed<SECTION_TEXT_AFTER>(lineNumber);
+                    section = line.substr(1, secEnd - 1);
+                    if (contains(section))
+                        staticDecodingFailed<SECTION_NOT_UNIQUE>(lineNumber);
+                    if (numSections_ == NUM_SECTIONS)
+                        staticDecodingFailed<SECTION_UNEXPECTED>(lineNumber);
+                    sections_[numSections_++] = section;
+                    inSection = true;
+                    continue;
+                }
+
+                std::size_t sepPos = line.find(fieldSep);
+                if (sepPos == std::string_view::npos)
+                    staticDecodingFailed<ILLEGAL_LINE>(lineNumber);
+                if (!inSection)
+                    staticDecodingFailed<FIELD_WITHOUT_SECTION>(lineNumber);
+                std::string_view key = trimStatic(line.substr(0, sepPos));
+                for (std::size_t idx = 0; idx < numFields_; idx++)
+                {
+                    if (fields_[idx].section == section && fields_[idx].key == key)
+                        staticDecodingFailed<FIELD_NOT_UNIQUE_IN_SECTION>
+                            (lineNumber);
+                }
+                if (numFields_ == NUM_FIELDS)
+                    staticDecodingFailed<FIELD_UNEXPECTED_IN_SECTION>(lineNumber);
+                fields_[numFields_++] =
+                    StaticIniField{section, key, trimStatic(line.substr(sepPos + 1))};
+            }
+        }
+
+        /**
+	 * Tries to place all fields in bucket \p bucket 
+	 * into free slots of their own using \p displacement. 
+	 * Returns whether this succeeded; if not, no slot is occupied. 
+	 */
+        constexpr bool place(std::size_t bucket, std::uint32_t displacement)
+        {
+            for (std::size_t idx = 0; idx < numFields_; idx++)
+            {
+                const StaticIniField &field = fields_[idx];
+                if (bucketOf(field.section, field.key) != bucket)
+                    continue;
+                std::size_t slot = slotOf(displacement, field.section, field.key);
+                if (slots_[slot] == 0)
+                {
+                    slots_[slot] = idx + 1;
+                    continue;
+                }
+                // collision: release the slots occupied so far 
+                for (std::size_t jdx = 0; jdx < idx; jdx++)
+                {
+                    const StaticIniField &other = fields_[jdx];
+                    if (bucketOf(other.section, other.key) == bucket)
+                        slots_[slotOf(displacement, other.section, other.key)] = 0;
+                }
+                return false;
+            }
+            return true;
+        }
+
+        constexpr void buildHash()
+        {
+            std::array<std::size_t, NUM_BUCKETS> bucketSizes{};
+            for (std::size_t idx = 0; idx < numFields_; idx++)
+                bucketSizes[bucketOf(fields_[idx].section, fields_[idx].key)]++;
+
+            // place the largest buckets first as they are the hardest 
+            std::array<bool, NUM_BUCKETS> placed{};
+            for (std::size_t num = 0; num < NUM_BUCKETS; num++)
+            {
+                std::size_t bucket = NUM_BUCKETS;
+                for (std::size_t cand = 0; cand < NUM_BUCKETS; cand++)
+                {
+                    if (!placed[cand] && (bucket == NUM_BUCKETS
+                                          || bucketSizes[cand] > bucketSizes[bucket]))
+                        bucket = cand;
+                }
+                if (bucketSizes[bucket] == 0)
+                    break;
+                placed[bucket] = true;
+                std::uint32_t displacement = 1;
+                while (!place(bucket, displacement))
+                    displacement++;
+                displacements_[bucket] = displacement;
+            }
+        }
+
+        template<class T>
+        static constexpr bool toInt(std::string_view str, T &result)
+        {
+            bool negative = false;
+            std::size_t pos = 0;
+            if (pos < str.size() && (str[pos] == '-' || str[pos] == '+'))
+                negative = str[pos++] == '-';
+            // base detection like strtol with base 0 
+            unsigned int base = 10;
+            if (pos + 1 < str.size() && str[pos] == '0'
+                && (str[pos + 1] == 'x' || str[pos + 1] == 'X'))
+            {
+                base = 16;
+                pos += 2;
+            }
+            else if (pos + 1 < str.size() && str[pos] == '0')
+            {
+                base = 8;
+                pos++;
+            }
+            if (pos == str.size() || (negative && std::is_unsigned<T>::value))
+                return false;
+            T value = 0;
+            for (; pos < str.size(); pos++)
+            {
+                char ch = str[pos];
+                unsigned int digit = base;
+                if (ch >= '0' && ch <= '9')
+                    digit = ch - '0';
+                else if (ch >= 'a' && ch <= 'f')
+                    digit = ch - 'a' + 10;
+                else if (ch >= 'A' && ch <= 'F')
+                    digit = ch - 'A' + 10;
+                if (digit >= base)
+                    return false;
+                T bound = negative
+                    ? (std::numeric_limits<T>::min() + (T)digit) / (T)base
+                    : (std::numeric_limits<T>::max() - (T)digit) / (T)base;
+                if (negative ? value < bound : value > bound)
+                    return false;
+                value = negative
+                    ? value * (T)base - (T)digit
+                    : value * (T)base + (T)digit;
+            }
+            result = value;
+            return true;
+        }
+
+        static constexpr bool toBool(std::string_view str, bool &result)
+        {
+            std::string_view expected = str.size() == 4 ? "true" : "false";
+            if (str.size() != expected.size())
+                return false;
+            for (std::size_t pos = 0; pos < str.size(); pos++)
+            {
+                char ch = str[pos];
+                if (ch >= 'A' && ch <= 'Z')
+                    ch = ch - 'A' + 'a';
+                if (ch != expected[pos])
+                    return false;
+            }
+            result = str.size() == 4;
+            return true;
+        }
+
+    public:
+        constexpr t_StaticIni(std::string_view text, char fieldSep, char comment)
+        {
+            decode(text, fieldSep, comment);
+            buildHash();
+        }
+
+        /**
+	 * Returns the number of sections. 
+	 */
+        constexpr std::size_t size() const
+        {
+            return numSections_;
+        }
+
+        /**
+	 * Returns the number of fields in all sections. 
+	 */
+        constexpr std::size_t numFields() const
+        {
+            return numFields_;
+        }
+
+        constexpr bool contains(std::string_view section) const
+        {
+            for (std::size_t idx = 0; idx < numSections_; idx++)
+            {
+                if (sections_[idx] == section)
+                    return true;
+            }
+            return false;
+        }
+
+        /**
+	 * Returns the field with key \p key in section \p section 
+	 * or NULL if there is no such field. 
+	 */
+        constexpr const StaticIniField *find(std::string_view section,
+                                             std::string_view key) const
+        {
+            std::size_t bucket = bucketOf(section, key);
+            std::size_t slot =
+                slots_[slotOf(displacements_[bucket], section, key)];
+            if (slot == 0)
+                return NULL;
+            const StaticIniField &field = fields_[slot - 1];
+            return field.section == section && field.key == key ? &field : NULL;
+        }
+
+        /**
+	 * Returns the value of the field with key \p key in section \p section 
+	 * or an empty view if there is no such field. 
+	 */
+        constexpr std::string_view value(std::string_view section,
+                                         std::string_view key) const
+        {
+            const StaticIniField *field = find(section, key);
+            return field == NULL ? std::string_view() : field->value;
+        }
+
+        /**
+	 * Returns the value of the field with key \p key in section \p section 
+	 * converted into \p T which is bool or an integer type 
+	 * or \p defaultValue if there is no such field 
+	 * or if conversion fails. 
+	 * Integers are read like IniField#as() does, 
+	 * i.e. decimal, octal with leading 0 or hexadecimal with leading 0x. 
+	 */
+        template<class T>
+        constexpr T get(std::string_view section,
+                        std::string_view key,
+                        T defaultValue) const
+        {
+            static_assert(std::is_integral<T>::value,
+                          "only bool and integer types are supported");
+            const StaticIniField *field = find(section, key);
+            if (field == NULL)
+                return defaultValue;
+            T result = defaultValue;
+            bool succ = false;
+            if constexpr (std::is_same<T, bool>::value)
+                succ = toBool(field->value, result);
+            else
+                succ = toInt(field->value, result);
+            return succ ? result : defaultValue;
+        }
+    }; // class t_StaticIni
+
+    /**
+     * Decodes \p text at compile time into a t_StaticIni 
+     * with at most \p NUM_SECTIONS sections and \p NUM_FIELDS fields. 
+     * The result holds views into \p text 
+     * which shall thus be a string literal. 
+     * Minimal sizes are given by #countStaticSections(std::string_view) 
+     * and #countStaticFields(std::string_view, char, char); 
+     * #parseStatic(F) determines them itself. 
+     */
+    template<std::size_t NUM_SECTIONS, std::size_t NUM_FIELDS>
+    INI_CONSTEVAL t_StaticIni<NUM_SECTIONS, NUM_FIELDS>
+    parseStatic(std::string_view text, char fieldSep = '=', char comment = '#')
+    {
+        return t_StaticIni<NUM_SECTIONS, NUM_FIELDS>(text, fieldSep, comment);
+    }
+
+    /**
+     * Decodes the string literal returned by \p text at compile time 
+     * into a t_StaticIni of minimal size, e.g. 
+     * <pre>
+     * constexpr auto defaults = ini::parseStatic([] {
+     *     return "[server]\n"
+     *            "port=8080\n"; });
+     * static_assert(defaults.get("server", "port", 0) == 8080);
+     * </pre>
+     *
+     * The separator and the comment character are given by 
+     * \p FIELD_SEP and \p COMMENT. 
+     *
+     * @param text
+     *    a lambda without captures returning a string literal. 
+     */
+    template<char FIELD_SEP = '=', char COMMENT = '#', class F>
+    INI_CONSTEVAL auto parseStatic(F text)
+    {
+        constexpr std::string_view str = text();
+        return parseStatic<countStaticSections(str),
+                           countStaticFields(str, FIELD_SEP, COMMENT)>
+            (str, FIELD_SEP, COMMENT);
+    }
+
+    /**
+     * Returns the FNV-1a hash of \p name. 
+     * This is constexpr so that the hashes of the keys of a schema 
+     * are computed at compile time. 
+     */
+    constexpr std::uint32_t hashName(std::string_view name)
+    {
+        std::uint32_t hash = 2166136261u;
+        for (char ch : name)
+        {
+            hash ^= (unsigned char)ch;
+            hash *= 16777619u;
+        }
+        return hash;
+    }
+
+    /**
+     * Binds the field with key #key to the member #member 
+     * of a struct of type \p S with type \p T. 
+     * Create instances with #bindField(const char*, T S::*). 
+     */
+    template<class S, class T>
+    class t_FieldBinding
+    {
+        static_assert(!std::is_pointer<T>::value,
+                      "a pointer member would dangle after decoding");
+    public:
+        typedef S Struct;
+
+        const char *key;
+        std::uint32_t hash;
+        T S::*member;
+
+        constexpr t_FieldBinding(const char *key, T S::*member)
+          : key(key), hash(hashName(key)), member(member)
+        {}
+
+        /**
+	 * Converts \p value into the type \p T 
+	 * as IniField#as() does and writes the result into #member of \p obj. 
+	 * Returns whether the conversion succeeded; 
+	 * if not the member is left unchanged. 
+	 * \p value may be moved from. 
+	 */
+        bool assign(std::string &value, S &obj) const
+        {
+            if constexpr (std::is_same<T, std::string>::value)
+            {
+                obj.*member = std::move(value);
+                return true;
+            }
+            else
+            {
+                IniField field(std::move(value));
+                T result = field.asUnconditional<T>();
+                if (field.failedLastOutConversion())
+                    return false;
+                obj.*member = result;
+                return true;
+            }
+        }
+    }; // class t_FieldBinding
+
+    template<class S, class T>
+    constexpr t_FieldBinding<S, T> bindField(const char *key, T S::*member)
+    {
+        return t_FieldBinding<S, T>(key, member);
+    }
+
+    /**
+     * Binds the section named #name to the fields \p Fields 
+     * which are all t_FieldBinding's for the same struct. 
+     * Create instances with #bindSection(const char*, Fields...). 
+     */
+    template<class S, class... Fields>
+    class t_SectionBinding
+    {
+    public:
+        typedef S Struct;
+        static constexpr std::size_t NUM_FIELDS = sizeof...(Fields);
+
+        const char *name;
+        std::uint32_t hash;
+        std::tuple<Fields...> fields;
+
+        constexpr t_SectionBinding(const char *name, Fields... fields)
+          : name(name), hash(hashName(name)), fields(fields...)
+        {}
+
+        /**
+	 * Returns the index of the field bound to key \p key 
+	 * or #NUM_FIELDS if there is no such field. 
+	 */
+        std::size_t indexOf(std::string_view key) const
+        {
+            return indexOf(key, hashName(key),
+                           std::index_sequence_for<Fields...>());
+        }
+
+        bool assign(std::size_t idx, std::string &value, S &obj) const
+        {
+            return assign(idx, value, obj,
+                          std::index_sequence_for<Fields...>());
+        }
+
+    private:
+        // The hashes are constants if the binding is constexpr, 
+        // so this unfolds into a sequence of comparisons with constants. 
+        template<std::size_t... I>
+        std::size_t indexOf(std::string_view key,
+                            std::uint32_t hash,
+                            std::index_sequence<I...>) const
+        {
+            std::size_t idx = NUM_FIELDS;
+            (void)((std::get<I>(fields).hash == hash
+                    && key == std::get<I>(fields).key
+                    && (idx = I, true)) || ...);
+            return idx;
+        }
+
+        template<std::size_t... I>
+        bool assign(std::size_t idx,
+                    std::string &value,
+                    S &obj,
+                    std::index_sequence<I...>) const
+        {
+            bool res = false;
+            (void)((idx == I
+                    && (res = std::get<I>(fields).assign(value, obj), true))
+                   || ...);
+            return res;
+        }
+    }; // class t_SectionBinding
+
+    template<class S, class... T>
+    constexpr t_SectionBinding<S, t_FieldBinding<S, T>...>
+    bindSection(const char *name, t_FieldBinding<S, T>... fields)
+    {
+        return t_SectionBinding<S, t_FieldBinding<S, T>...>(name, fields...);
+    }
+
+    /**
+     * The schema binding an ini-file to a struct of type \p S: 
+     * each of the \p Sections is a t_SectionBinding for \p S. 
+     * Create instances with #bindSchema(First, Rest...). 
+     */
+    template<class S, class... Sections>
+    class t_Schema
+    {
+    public:
+        static constexpr std::size_t NUM_SECTIONS = sizeof...(Sections);
+        static constexpr std::size_t MAX_FIELDS =
+            std::max({std::size_t(0), Sections::NUM_FIELDS...});
+
+        std::tuple<Sections...> sections;
+
+        constexpr t_Schema(Sections... sections) : sections(sections...)
+        {}
+
+        /**
+	 * Returns the index of the section named \p name 
+	 * or #NUM_SECTIONS if there is no such section. 
+	 */
+        std::size_t indexOf(std::string_view name) const
+        {
+            return indexOf(name, hashName(name),
+                           std::index_sequence_for<Sections...>());
+        }
+
+        /**
+	 * Returns the index of the field with key \p key 
+	 * in the section with index \p idxSec 
+	 * or #MAX_FIELDS if there is no such field. 
+	 */
+        std::size_t indexOf(std::size_t idxSec, std::string_view key) const
+        {
+            return indexOf(idxSec, key,
+                           std::index_sequence_for<Sections...>());
+        }
+
+        bool assign(std::size_t idxSec,
+                    std::size_t idxField,
+                    std::string &value,
+                    S &obj) const
+        {
+            return assign(idxSec, idxField, value, obj,
+                          std::index_sequence_for<Sections...>());
+        }
+
+    private:
+        template<std::size_t... I>
+        std::size_t indexOf(std::string_view name,
+                            std::uint32_t hash,
+                            std::index_sequence<I...>) const
+        {
+            std::size_t idx = NUM_SECTIONS;
+            (void)((std::get<I>(sections).hash == hash
+                    && name == std::get<I>(sections).name
+                    && (idx = I, true)) || ...);
+            return idx;
+        }
+
+        template<std::size_t I>
+        std::size_t indexOfIn(std::string_view key) const
+        {
+            std::size_t idx = std::get<I>(sections).indexOf(key);
+            return idx == std::get<I>(sections).NUM_FIELDS ? MAX_FIELDS : idx;
+        }
+
+        template<std::size_t... I>
+        std::size_t indexOf(std::size_t idxSec,
+                            std::string_view key,
+                            std::index_sequence<I...>) const
+        {
+            std::size_t idx = MAX_FIELDS;
+            (void)((idxSec == I && (idx = indexOfIn<I>(key), true)) || ...);
+            return idx;
+        }
+
+        template<std::size_t... I>
+        bool assign(std::size_t idxSec,
+                    std::size_t idxField,
+                    std::string &value,
+                    S &obj,
+                    std::index_sequence<I...>) const
+        {
+            bool res = false;
+            (void)((idxSec == I
+                    && (res = std::get<I>(sections)
+                                  .assign(idxField, value, obj), true))
+                   || ...);
+            return res;
+        }
+    }; // class t_Schema
+
+    template<class First, class... Rest>
+    constexpr t_Schema<typename First::Struct, First, Rest...>
+    bindSchema(First first, Rest... rest)
+    {
+        return t_Schema<typename First::Struct, First, Rest...>(first, rest...);
+    }
+
+    /**
+     * Provides the schema binding an ini-file to a struct of type \p S 
+     * for IniFile#tryDecode(InStreamInterface&, S&) 
+     * By default this is <c>S::iniSchema()</c> 
+     * which shall be a static constexpr function 
+     * returning the result of #bindSchema(First, Rest...), e.g. 
+     * <pre>
+     * struct Logging
+     * {
+     *     std::string level;
+     *     unsigned int rotate;
+     *     static constexpr auto iniSchema()
+     *     {
+     *         return ini::bindSchema(ini::bindSection("logging",
+     *             ini::bindField("level",  &Logging::level),
+     *             ini::bindField("rotate", &Logging::rotate)));
+     *     }
+     * };
+     * </pre>
+     * For structs which cannot be changed, specialize this template. 
+     */
+    template<class S>
+    class IniSchema
+    {
+    public:
+        static constexpr auto get()
+        {
+            return S::iniSchema();
+        }
+    }; // class IniSchema
+
+    /**
+     * Identifies a file and its state when it was read as given by stat. 
+     * Device and inode identify a file whatever path leads to it. 
+     * Modification times are in seconds 
+     * and on linux in addition in nanoseconds. 
+     */
+    class FileStamp
+    {
+    public:
+        unsigned long long dev;
+        unsigned long long ino;
+        long long mtimeSec;
+        long long mtimeNsec;
+        long long size;
+
+        /**
+	 * Returns whether this could be read from the file \p path. 
+	 */
+        bool read(const std::string &path)
+        {
+            struct stat st;
+            if (stat(path.c_str(), &st) != 0)
+                return false;
+            dev = st.st_dev;
+            ino = st.st_ino;
+            mtimeSec = st.st_mtime;
+#ifdef __linux__
+            mtimeNsec = st.st_mtim.tv_nsec;
+#else
+            mtimeNsec = 0;
+#endif
+            size = st.st_size;
+            return true;
+        }
+
+        bool sameFile(const FileStamp &other) const
+        {
+            return dev == other.dev && ino == other.ino;
+        }
+
+        bool operator==(const FileStamp &other) const
+        {
+            return sameFile(other)
+                && mtimeSec == other.mtimeSec
+                && mtimeNsec == other.mtimeNsec
+                && size == other.size;
+        }
+    }; // class FileStamp
+
+    /**
+     * The files mapped into memory in this process 
+     * by IniFile#tryLoad(const std::string&), 
+     * see IniFile#setLargeValueThreshold, 
+     * identified by device and inode 
+     * with the number of mappings of each. 
+     * Saving replaces such a file by a new one 
+     * instead of overwriting it in place, 
+     * as accessing a mapping of a truncated file fails with SIGBUS. 
+     */
+    class MappedFiles
+    {
+    private:
+        typedef std::pair<unsigned long long, unsigned long long> Id;
+
+        class IdHash
+        {
+        public:
+            std::size_t operator()(const Id &id) const
+            {
+                return std::hash<unsigned long long>()(id.first * 0x9e3779b97f4a7c15ull
+                                                       ^ id.second);
+            }
+        }; // class IdHash
+
+        std::unordered_map<Id, unsigned int, IdHash> numMappings_;
+#ifndef THREADS_PREVENTED
+        std::mutex mutex_;
+#endif
+
+    public:
+        static MappedFiles &instance()
+        {
+            static MappedFiles files;
+            return files;
+        }
+
+        void add(unsigned long long dev, unsigned long long ino)
+        {
+#ifndef THREADS_PREVENTED
+            std::lock_guard<std::mutex> lock(mutex_);
+#endif
+            numMappings_[Id(dev, ino)]++;
+        }
+
+        void remove(unsigned long long dev, unsigned long long ino)
+        {
+#ifndef THREADS_PREVENTED
+            std::lock_guard<std::mutex> lock(mutex_);
+#endif
+            std::unordered_map<Id, unsigned int, IdHash>::iterator found =
+                numMappings_.find(Id(dev, ino));
+            if (found != numMappings_.end() && --found->second == 0)
+                numMappings_.erase(found);
+        }
+
+        /**
+	 * Returns whether the file \p path exists and is mapped. 
+	 */
+        bool contains(const std::string &path)
+        {
+            FileStamp stamp;
+            if (!stamp.read(path))
+                return false;
+#ifndef THREADS_PREVENTED
+            std::lock_guard<std::mutex> lock(mutex_);
+#endif
+            return numMappings_.count(Id(stamp.dev, stamp.ino)) != 0;
+        }
+    }; // class MappedFiles
+
+    /**
+     * A process wide cache of objects of type \p T read from files, 
+     * e.g. decoded ini-files, 
+     * keyed by device and inode of the file. 
+     * An entry is valid as long as modification time and size are unchanged 
+     * and as long as the validator given to #get accepts it, 
+     * e.g. if it was decoded with the same grammar. 
+     * The sum of the sizes of the entries is bounded by a capacity; 
+     * the least recently used entries are evicted first. 
+     * Entries are immutable and shared, 
+     * so evicting or replacing one does not affect its users. 
+     * Access is serialized unless THREADS_PREVENTED is set, 
+     * but loading is not, see #get. 
+     */
+    template<class T>
+    class t_FileCache
     {
-        // indicates that encoding/decoding finished without failure 
-        NO_FAILURE = 0,
-	// indicates that a section was not closed,
-	// i.e. a line started with '[' but had no according ']'
-	// in the course of decoding. 
-	SECTION_NOT_CLOSED,
-	// indicates that a section name was empty,
-	// i.e. a line started with '[]'
-	// in the course of decoding. 
-	SECTION_NAME_EMPTY,
-	// indicates that in a line defining a section there was text after ']'
-	// i.e. ']' was not immediately followed by '\n' 
-	// in the course of decoding. 
-	SECTION_TEXT_AFTER,
-	// indicates that a section name occurred more than once
-	// in the course of decoding. 
-	SECTION_NOT_UNIQUE,
-	// Indicates at the moment
-	// that one more section is found than specified.
-	// TBD: In the long run, this can also indicate
-	// that the name of the section does not fit the grammar. 
-	SECTION_UNEXPECTED,
-	// indicates that during decoding an illegal line was found,
-	// i.e. a line which is neither empty, 
-	// (nor a comment lineby default starting with '#') 
-	// nor a section line (starting with '[')
-	// nor a key-value-line (containing by default '=').
-	ILLEGAL_LINE,
-	// indicates that during decoding a field was found 
-	// without preceeding section 
-	FIELD_WITHOUT_SECTION,
-	// indicates that during decoding a field was found 
-	// with a key which is not unique within its section. 
-	FIELD_NOT_UNIQUE_IN_SECTION,
-	// Indicates at the moment,
-	// that one more field is found in the section as specified.
-	// TBD: In the long run, this can also indicate,
-	// that the name of the field does not fit the grammar. 
-	FIELD_UNEXPECTED_IN_SECTION,
+    private:
+        class Entry
+        {
+        public:
+            FileStamp stamp;
+            std::shared_ptr<const T> value;
+            std::size_t size;
+        }; // class Entry
+
+        class IdHash
+        {
+        public:
+            std::size_t operator()(const std::pair<unsigned long long,
+                                                   unsigned long long> &id) const
+            {
+                return std::hash<unsigned long long>()(id.first * 0x9e3779b97f4a7c15ull
+                                                       ^ id.second);
+            }
+        }; // class IdHash
+
+        typedef std::pair<unsigned long long, unsigned long long> Id;
+
+        // most recently used first 
+        std::list<Entry> entries_;
+        std::unordered_map<Id, typename std::list<Entry>::iterator, IdHash> index_;
+        std::size_t capacity_;
+        std::size_t size_;
+#ifndef THREADS_PREVENTED
+        std::mutex mutex_;
+        // the files being loaded by #get outside the lock 
+        std::unordered_set<Id, IdHash> inFlight_;
+        // notified whenever a file in #inFlight_ is done 
+        std::condition_variable loaded_;
+
+        /**
+	 * Keeps a file in #inFlight_ while loading it 
+	 * with the lock released, 
+	 * re-locking and notifying waiting threads when done 
+	 * also if loading throws. 
+	 */
+        class InFlight
+        {
+        private:
+            t_FileCache &cache_;
+            std::unique_lock<std::mutex> &lock_;
+            Id id_;
+        public:
+            InFlight(t_FileCache &cache, std::unique_lock<std::mutex> &lock,
+                     const Id &id)
+              : cache_(cache), lock_(lock), id_(id)
+            {
+                cache_.inFlight_.insert(id_);
+                lock_.unlock();
+            }
+            ~InFlight()
+            {
+                lock_.lock();
+                cache_.inFlight_.erase(id_);
+                cache_.loaded_.notify_all();
+            }
+        }; // class InFlight
+#endif
+
+        void erase(typename std::list<Entry>::iterator entry)
+        {
+            size_ -= entry->size;
+            index_.erase(Id(entry->stamp.dev, entry->stamp.ino));
+            entries_.erase(entry);
+        }
+
+        void evict()
+        {
+            while (size_ > capacity_)
+                erase(std::prev(entries_.end()));
+        }
+
+    public:
+        /**
+	 * @param capacity
+	 *    the maximal sum of the sizes of all entries; 
+	 *    if 0, nothing is cached. 
+	 */
+        t_FileCache(std::size_t capacity) : capacity_(capacity), size_(0)
+        {}
+
+        /**
+	 * Returns the object for the file with state \p stamp 
+	 * if cached and accepted by \p isValid(const T&); 
+	 * else the object created by \p load(std::size_t &size) 
+	 * which is cached unless it is NULL, 
+	 * signifying a failure, 
+	 * or its size exceeds the capacity. 
+	 * The lock is released while loading 
+	 * so that other files are looked up and loaded meanwhile, 
+	 * whereas threads getting the same file wait for the load 
+	 * so that it is loaded only once. 
+	 */
+        template<class IsValid, class Load>
+        std::shared_ptr<const T> get(const FileStamp &stamp,
+                                     IsValid isValid,
+                                     Load load)
+        {
+            Id id(stamp.dev, stamp.ino);
+#ifndef THREADS_PREVENTED
+            std::unique_lock<std::mutex> lock(mutex_);
+            loaded_.wait(lock, [this, &id] { return inFlight_.count(id) == 0; });
+#endif
+            typename std::unordered_map<Id, typename std::list<Entry>::iterator,
+                                        IdHash>::iterator found = index_.find(id);
+            if (found != index_.end())
+            {
+                typename std::list<Entry>::iterator entry = found->second;
+                if (entry->stamp == stamp && isValid(*entry->value))
+                {
+                    entries_.splice(entries_.begin(), entries_, entry);
+                    return entry->value;
+                }
+                erase(entry);
+            }
+
+            std::size_t size = 0;
+            std::shared_ptr<const T> value;
+            {
+#ifndef THREADS_PREVENTED
+                InFlight inFlight(*this, lock, id);
+#endif
+                value = load(size);
+            }
+            if (value == NULL || size > capacity_)
+                return value;
+            entries_.push_front(Entry{stamp, value, size});
+            index_[id] = entries_.begin();
+            size_ += size;
+            evict();
+            return value;
+        }
+
+        /**
+	 * Sets the capacity evicting entries if necessary. 
+	 */
+        void setCapacity(std::size_t capacity)
+        {
+#ifndef THREADS_PREVENTED
+            std::lock_guard<std::mutex> lock(mutex_);
+#endif
+            capacity_ = capacity;
+            evict();
+        }
+
+        std::size_t getCapacity()
+        {
+#ifndef THREADS_PREVENTED
+            std::lock_guard<std::mutex> lock(mutex_);
+#endif
+            return capacity_;
+        }
+
+        /**
+	 * Returns the sum of the sizes of all entries. 
+	 */
+        std::size_t size()
+        {
+#ifndef THREADS_PREVENTED
+            std::lock_guard<std::mutex> lock(mutex_);
+#endif
+            return size_;
+        }
+
+        std::size_t numEntries()
+        {
+#ifndef THREADS_PREVENTED
+            std::lock_guard<std::mutex> lock(mutex_);
+#endif
+            return entries_.size();
+        }
+
+        void clear()
+        {
+#ifndef THREADS_PREVENTED
+            std::lock_guard<std::mutex> lock(mutex_);
+#endif
+            entries_.clear();
+            index_.clear();
+            size_ = 0;
+        }
+    }; // class t_FileCache
+
+    /**
+     * Selects the sections to be loaded 
+     * by IniFile#tryLoad(const std::string&, const SectionFilter&), 
+     * either by their names or by a predicate on the name. 
+     */
+    class SectionFilter
+    {
+    private:
+        std::vector<std::string> names_;
+        std::function<bool(std::string_view)> predicate_;
+    public:
+        SectionFilter(std::initializer_list<std::string_view> names)
+        {
+            for (std::string_view name : names)
+                names_.emplace_back(name);
+        }
+
+        SectionFilter(const std::vector<std::string> &names) : names_(names)
+        {}
+
+        SectionFilter(std::function<bool(std::string_view)> predicate)
+          : predicate_(predicate)
+        {}
+
+        bool accepts(std::string_view secName) const
+        {
+            if (predicate_)
+                return predicate_(secName);
+            for (const std::string &name : names_)
+            {
+                if (name == secName)
+                    return true;
+            }
+            return false;
+        }
+    }; // class SectionFilter
+
+    /**
+     * Tells whether \p T is a source of lines to decode, 
+     * providing <c>isOpen()</c>, <c>getLine(std::string&)</c>, 
+     * <c>bad()</c> and <c>close()</c> like IniFile#InStreamInterface. 
+     * The decoder is a template over the source, 
+     * so for a source of a final class, 
+     * e.g. IniFile#InStringViewStream, the loop reading lines is inlined, 
+     * whereas IniFile#InStreamInterface serves as an adapter 
+     * for other sources at the cost of a virtual call per line. 
+     */
+    template<class T, class = void>
+    class t_IsLineSource : public std::false_type
+    {};
+
+    template<class T>
+    class t_IsLineSource<T, std::void_t<
+        decltype(static_cast<bool>(std::declval<T&>().isOpen())),
+        decltype(static_cast<bool>(std::declval<T&>().getLine(std::declval<std::string&>()))),
+        decltype(static_cast<bool>(std::declval<T&>().bad())),
+        decltype(std::declval<T&>().close())> > : public std::true_type
+    {};
+
+#if __cplusplus >= 202002L
+    template<class T>
+    concept LineSource = t_IsLineSource<T>::value;
+#endif
+
+    /**
+     * Reads the value of the field \p key in section \p section 
+     * of the file \p path into \p value 
+     * without decoding the file into an IniFile. 
+     * The file is read line by line until the field is found 
+     * or the section is left. 
+     * Lines are decoded like by IniFile#tryDecode(InStreamInterface&) 
+     * with field separator \p fieldSep and comment character \p comment, 
+     * except that the fields of other sections are not decoded 
+     * and thus not checked. 
+     * Include directives are not supported. 
+     *
+     * @return
+     *    DecEncErrorCode#NO_FAILURE if found, 
+     *    DecEncErrorCode#FIELD_NOT_FOUND if not 
+     *    or another error code if the file cannot be read or decoded. 
+     */
+    inline DecEncErrorCode findValue(const std::string &path,
+                                     std::string_view section,
+                                     std::string_view key,
+                                     std::string &value,
+                                     char fieldSep = '=',
+                                     char comment = '#');
+
+
+    /**
+     * The dialect of IniFile: 
+     * the separator and the comment character are given at runtime, 
+     * by default '=' and '#', 
+     * blanks and tabs are trimmed 
+     * and lines may end with \r\n. 
+     * A dialect fixed at compile time is given by #t_StaticDialect 
+     * or by any class providing the same members. 
+     */
+    class RuntimeDialect
+    {
+    public:
+        // whether #FIELD_SEP and #COMMENT apply instead of members 
+        static const bool IS_STATIC = false;
+        static const char FIELD_SEP = '=';
+        static const char COMMENT = '#';
+        // whether a \r before \n is ignored 
+        static const bool ACCEPT_CRLF = true;
+
+        static constexpr bool isBlank(char ch)
+        {
+            return ch == ' ' || ch == '\t';
+        }
+    }; // class RuntimeDialect
+
+    /**
+     * A dialect for t_IniFile fixed at compile time: 
+     * the separator \p FIELD_SEP_, the comment character \p COMMENT_, 
+     * whether lines may end with \r\n and the blank characters \p BLANKS 
+     * trimmed from lines, keys and values, 
+     * by default blank and tab. 
+     * Being constants, these allow the compiler 
+     * to specialize the loop scanning the lines. 
+     */
+    template<char FIELD_SEP_, char COMMENT_,
+             bool ACCEPT_CRLF_ = true, char... BLANKS>
+    class t_StaticDialect
+    {
+    public:
+        static const bool IS_STATIC = true;
+        static const char FIELD_SEP = FIELD_SEP_;
+        static const char COMMENT = COMMENT_;
+        static const bool ACCEPT_CRLF = ACCEPT_CRLF_;
+
+        static constexpr bool isBlank(char ch)
+        {
+            if constexpr (sizeof...(BLANKS) == 0)
+                return RuntimeDialect::isBlank(ch);
+            else
+                return ((ch == BLANKS) || ...);
+        }
+    }; // class t_StaticDialect
+
+    /**
+     * Classifies the bytes as blank or not for \p Dialect 
+     * by a table computed at compile time. 
+     */
+    template<class Dialect>
+    class t_BlankTable
+    {
+    private:
+        static constexpr std::array<bool, 256> create()
+        {
+            std::array<bool, 256> table = {};
+            for (int ch = 0; ch < 256; ch++)
+                table[ch] = Dialect::isBlank(static_cast<char>(ch));
+            return table;
+        }
+        static constexpr std::array<bool, 256> TABLE = create();
+    public:
+        static constexpr bool isBlank(char ch)
+        {
+            return TABLE[static_cast<unsigned char>(ch)];
+        }
+
+        /**
+	 * Returns \p str without leading and trailing blanks 
+	 * like #trimStatic for RuntimeDialect. 
+	 */
+        static constexpr std::string_view trim(std::string_view str)
+        {
+            std::size_t begin = 0;
+            std::size_t end = str.size();
+            while (begin < end && isBlank(str[begin]))
+                begin++;
+            while (end > begin && isBlank(str[end - 1]))
+                end--;
+            return str.substr(begin, end - begin);
+        }
+    }; // class t_BlankTable
+
+    /**
+     * An ini-file of dialect \p Dialect, e.g. #t_StaticDialect; 
+     * usually this is #IniFile, 
+     * with separator and comment character given at runtime. 
+     */
+    template<class Dialect>
+    class t_IniFile
+    {
+        template<class D> friend class t_IniFile;
+        friend DecEncErrorCode findValue(const std::string&,
+                                         std::string_view,
+                                         std::string_view,
+                                         std::string&,
+                                         char,
+                                         char);
+
+    public:
+      	class DecEncResult
+	{
+	  friend t_IniFile;
+	private:
+	    /**
+	     * This is DecEncErrorCode#NO_FAILURE if all ok so far. 
+	     */
+	    DecEncErrorCode errorCode;
+	    /**
+	     * The line number where a failure occurs 
+	     * during decode/encode, 
+	     * line numbers starting with 1. 
+	     * This is immaterial if no failure occurred (yet). 
+	     * At the end of successful encode/decode 
+	     * it is the last line enumber. 
+	     * It is set to 0 if the failure does not correspond 
+	     * with a line number, 
+	     * e.g. if open file fails. 
+	     */
+	    unsigned int lineNumber;
+	    /*
+	     * This is <c>null</c> if reading from/writing to 
+	     * a stream without file. 
+	     */
+	    //std::string fileName;
+#ifdef DEC_ENC_STATISTICS_ENABLED
+	    DecEncStatistics statistics;
+#endif
+	    
+
+	protected:
+
+	    DecEncResult set(DecEncErrorCode errorCode)
+	    {
+	     	this->errorCode  = errorCode;
+		return *this;
+	    }
+	    void reset()
+	    {
+	      this->errorCode  = NO_FAILURE;
+	      this->lineNumber = 0;
+#ifdef DEC_ENC_STATISTICS_ENABLED
+	      this->statistics = DecEncStatistics();
+#endif
+	    }
+	    void incLineNo()
+	    {
+	        lineNumber++;
+	    }
+	public:
+	    DecEncResult() 
+	    {
+	      reset();
+	    }
+	    DecEncErrorCode getErrorCode()
+	    {
+	        return errorCode;
+	    }
+	    int getLineNumber()
+	    {
+	        return lineNumber;
+	    }
+	    bool isOk()
+	    {
+	      return this->errorCode == NO_FAILURE;
+	    }
+#ifdef DEC_ENC_STATISTICS_ENABLED
+	    const DecEncStatistics &getStatistics() const
+	    {
+	        return statistics;
+	    }
+#endif
+
+	}; // class DecEncResult
+
+    private:
+	const static char SEC_START = '[';
+ 	const static char SEC_END   = ']';
+
+        DecEncResult deResult;
+        /**
+	 * Mutable as in lazy mode sections are decoded on first access, 
+	 * also by const methods, see #setLazy(bool). 
+	 */
+        mutable t_ResVMap<IniSection> map;
+     
+      
+      // TBD: rework
+      // This is preliminary:
+      // an array with one entry per section
+      // specifying the number of keys in a section.
+      // This is the first step towards a validating parser
+      // but also to elimination of the vector class. 
+      std::vector<unsigned int> lenSections_;
+
+        char fieldSep_;
+        char comment_;
+        /**
+	 * The include directive or empty if including is not allowed. 
+	 * @see #setIncludeDirective(const std::string&) 
+	 */
+        std::string includeDirective_;
+        /**
+	 * If not NULL, collects the files included while decoding 
+	 * together with their state, see #tryLoadShared. 
+	 */
+        std::vector<std::pair<std::string, FileStamp> > *includedFiles_ = NULL;
+
+        /**
+	 * A section indexed by a lazy #tryLoad(const std::string&) 
+	 * whose fields are decoded from #source_ on first access. 
+	 */
+        class LazySection
+        {
+        public:
+            // the lines of the fields in #source_ 
+            std::size_t begin;
+            std::size_t end;
+            // the number of the line defining the section 
+            unsigned int lineNumber;
+            // the index of the section in the file for #lenSections_ 
+            unsigned int idxSec;
+            bool decoded;
+        }; // class LazySection
+
+        /**
+	 * Whether #tryLoad(const std::string&) only indexes sections. 
+	 * @see #setLazy(bool) 
+	 */
+        bool lazy_ = false;
+
+        /**
+	 * The length above which values are kept in the file loaded 
+	 * instead of being copied; 0 if all are copied. 
+	 * @see #setLargeValueThreshold(std::size_t) 
+	 */
+        std::size_t largeValueThreshold_ = 0;
+        /**
+	 * The file loaded lazily, 
+	 * with the i-th entry of #lazySections_ 
+	 * referring to the i-th section of #map. 
+	 * Sections added later have no entry. 
+	 */
+        std::string source_;
+        mutable std::vector<LazySection> lazySections_;
+        mutable std::size_t numUndecoded_ = 0;
+        /**
+	 * The first failure decoding a section lazily. 
+	 */
+        mutable DecEncResult lazyResult_;
+
+#ifndef THREADS_PREVENTED
+        /**
+	 * A mutex which is not copied with the IniFile holding it 
+	 * but created anew. 
+	 */
+        class LazyMutex
+        {
+        public:
+            std::mutex mutex;
+            LazyMutex()
+            {}
+            LazyMutex(const LazyMutex &)
+            {}
+            LazyMutex &operator=(const LazyMutex &)
+            {
+                return *this;
+            }
+        }; // class LazyMutex
+
+        /**
+	 * Serializes decoding lazily 
+	 * so that const methods may run concurrently also after a lazy load. 
+	 */
+        mutable LazyMutex lazyMutex_;
+#endif
+
+        /**
+	 * A generation by FieldHandle#nextGeneration() 
+	 * which is not copied but renewed with the IniFile holding it. 
+	 */
+        class Generation
+        {
+        public:
+            std::uint64_t value;
+            Generation() : value(FieldHandle::nextGeneration())
+            {}
+            Generation(const Generation &) : value(FieldHandle::nextGeneration())
+            {}
+            Generation &operator=(const Generation &)
+            {
+                renew();
+                return *this;
+            }
+            void renew()
+            {
+                value = FieldHandle::nextGeneration();
+            }
+        }; // class Generation
+
+        /**
+	 * Renewed on construction and whenever the sections are replaced, 
+	 * also by assignment, 
+	 * invalidating all FieldHandles resolved before. 
+	 */
+        Generation generation_;
+
+#ifdef DEC_ENC_STATISTICS_ENABLED
+        /**
+	 * Records the statistics of the decode/encode in progress 
+	 * into a DecEncResult. 
+	 * The time between construction and #finish() 
+	 * not spent in I/O or inserting is attributed to scanning. 
+	 */
+        class StatRecorder
+        {
+        private:
+            typedef std::chrono::steady_clock Clock;
+            DecEncStatistics &stats_;
+            Clock::time_point start_;
+            Clock::time_point phaseStart_;
+            std::size_t numAllocationsStart_;
+        public:
+            StatRecorder(DecEncResult &deResult)
+              : stats_(deResult.statistics),
+                start_(Clock::now()),
+                numAllocationsStart_(allocationCounter == NULL
+                                     ? 0 : allocationCounter())
+            {}
+            void line(std::size_t length)
+            {
+                stats_.numLines_++;
+                stats_.numBytes_ += length + 1;
+                stats_.maxLineLength_ = std::max(stats_.maxLineLength_, length);
+            }
+            void comment()
+            {
+                stats_.numComments_++;
+            }
+            void section()
+            {
+                stats_.numSections_++;
+            }
+            void field()
+            {
+                stats_.numFields_++;
+            }
+            void startPhase()
+            {
+                phaseStart_ = Clock::now();
+            }
+            void stopIo()
+            {
+                stats_.ioTime_ += Clock::now() - phaseStart_;
+            }
+            void stopInsert()
+            {
+                stats_.insertTime_ += Clock::now() - phaseStart_;
+            }
+            void finish()
+            {
+                stats_.scanTime_ = Clock::now() - start_
+                    - stats_.ioTime_ - stats_.insertTime_;
+                if (allocationCounter != NULL)
+                    stats_.numAllocations_ =
+                        allocationCounter() - numAllocationsStart_;
+            }
+        }; // class StatRecorder
+#else
+        // records nothing 
+        class StatRecorder
+        {
+        public:
+            StatRecorder(DecEncResult&) {}
+            void line(std::size_t) {}
+            void comment() {}
+            void section() {}
+            void field() {}
+            void startPhase() {}
+            void stopIo() {}
+            void stopInsert() {}
+            void finish() {}
+        }; // class StatRecorder
+#endif
+
+        // in place, so without allocation 
+        static void trim(std::string &str)
+        {
+            std::string_view trimmed = t_BlankTable<Dialect>::trim(str);
+            str.erase(trimmed.data() - str.data() + trimmed.size());
+            str.erase(0, trimmed.data() - str.data());
+        }
+
+        /**
+	 * Returns the separator of key and value: 
+	 * a constant of a static dialect or else #fieldSep_. 
+	 */
+        char fieldSepChar() const
+        {
+            if constexpr (Dialect::IS_STATIC)
+                return Dialect::FIELD_SEP;
+            else
+                return fieldSep_;
+        }
+
+        char commentChar() const
+        {
+            if constexpr (Dialect::IS_STATIC)
+                return Dialect::COMMENT;
+            else
+                return comment_;
+        }
+
+    public:
+
 	
-	// TBD: occurs during decoding
-	// of file streams only, not for string streams
-	// if trying to open file which does not exist, or is not readable
-	// or if a directory in windows, even if readable flag set. 
-	STREAM_OPENR_FAILED,
-	// TBD: occurs during encoding
-	// for file streams only, not for string streams
-	// if trying to open file which does not exist, or is not writable 
-	STREAM_OPENW_FAILED,
-	// during decoding if
-	// trying to read from a directory which is readable on linux
-	// maybe other cases 
-	STREAM_READ_FAILED,
-	// during encoding if trying to write to directory which is writable 
-	// maybe other cases 
-	STREAM_WRITE_FAILED
-    };
+      t_IniFile(std::vector<unsigned int> lenSections)
+	: t_IniFile(lenSections, Dialect::FIELD_SEP, Dialect::COMMENT)
+        {}
+
+      t_IniFile(std::vector<unsigned int> lenSections,
+	      const char fieldSep,
+	      const char comment)
+	: lenSections_(lenSections), fieldSep_(fieldSep), comment_(comment)
+        {}
+
+        ~t_IniFile()
+        {}
+
+
+
+ 
+
+
+# ifndef THROW_PREVENTED
+        t_IniFile(const std::string &filename,
+		std::vector<unsigned int> lenSections,
+		const char fieldSep,
+		const char comment)
+	  : t_IniFile(lenSections, fieldSep, comment)
+        {
+	    load(filename);
+        }
+
+ # ifndef SSTREAM_PREVENTED
+       t_IniFile(std::istream &is,
+	       std::vector<unsigned int> lenSections,
+	       const char fieldSep,
+	       const char comment)
+	  : t_IniFile(lenSections, fieldSep, comment)
+        {
+           decode(is);
+	}
+
+      // TBD: the above constructor shall be replaced by the ones below
+      // to get the right exceptions. 
+        t_IniFile(std::ifstream &is,
+		std::vector<unsigned int> lenSections,
+		const char fieldSep,
+		const char comment)
+	  : t_IniFile(lenSections, fieldSep, comment)
+        {
+           decode(is);
+	}
+      
+        t_IniFile(std::istringstream &is,
+		std::vector<unsigned int> lenSections,
+		const char fieldSep,
+		const char comment)
+	  : t_IniFile(lenSections, fieldSep, comment)
+        {
+           decode(is);
+	}
+#endif
+
+#endif
+
+
+      
+
+        void setFieldSep(const char sep)
+        {
+            static_assert(!Dialect::IS_STATIC, "separator fixed by dialect");
+            fieldSep_ = sep;
+        }
+
+        void setCommentChar(const char comment)
+        {
+            static_assert(!Dialect::IS_STATIC, "comment fixed by dialect");
+            comment_ = comment;
+        }
+
+        /**
+	 * Allows decoding to include files: 
+	 * a line consisting of \p directive, blanks and a path 
+	 * is replaced by the sections and fields of the file at the path, 
+	 * relative to the directory of the including file 
+	 * or to the current directory if decoding a stream or a string. 
+	 * The fields of an included file may belong to a section 
+	 * opened before the directive 
+	 * and subsequent fields to a section opened in the included file. 
+	 * Cyclic inclusion fails with DecEncErrorCode#INCLUDE_CYCLIC. 
+	 * Included files are cached per process, 
+	 * see #clearIncludeCache(). 
+	 * The directive is recognized before comments, 
+	 * so it may start with the comment character. 
+	 *
+	 * @param directive
+	 *    e.g. <c>!include</c>; 
+	 *    if empty, which is the default, nothing is included. 
+	 */
+        void setIncludeDirective(const std::string &directive)
+        {
+            includeDirective_ = directive;
+        }
+
+        /**
+	 * Sets whether #tryLoad(const std::string&) decodes lazily: 
+	 * loading only finds the sections, 
+	 * checking them for uniqueness and number, 
+	 * and keeps the file; 
+	 * the fields of a section are decoded and checked 
+	 * on first access of the section 
+	 * by #operator[](std::string_view) or any method using all sections. 
+	 * So loading costs a scan for the sections 
+	 * and decoding is proportional to the sections used. 
+	 * A failure in a section is not reported by loading 
+	 * but by #tryValidate(); 
+	 * the section then holds the fields before the failing line. 
+	 * Decoding lazily modifies this IniFile also via const methods, 
+	 * which is serialized by a mutex unless THREADS_PREVENTED is set, 
+	 * so that const methods may still run concurrently. 
+	 * Files are decoded eagerly if an include directive is set 
+	 * and by all methods other than #tryLoad(const std::string&) 
+	 * and #load(const std::string&). 
+	 *
+	 * @param lazy
+	 *    whether to decode lazily; false by default. 
+	 */
+        void setLazy(bool lazy)
+        {
+            lazy_ = lazy;
+        }
+
+        /**
+	 * Sets the length above which #tryLoad(const std::string&) 
+	 * does not copy values but keeps them in the file loaded, 
+	 * which is mapped into memory where possible, 
+	 * so that a file with a few huge values 
+	 * does not take twice its size in memory. 
+	 * Such fields are IniField#isExternal(); 
+	 * they are viewed and read in chunks by IniField#view() 
+	 * and IniField#reader() without copying. 
+	 * The file is freed with the last field referring to it. 
+	 * Until then it must not be truncated or overwritten in place, 
+	 * e.g. by another process, 
+	 * as accessing a value in a truncated file fails with SIGBUS. 
+	 * #trySave, #save and #saveAll replace a file mapped by a new one 
+	 * instead of overwriting it. 
+	 * The default 0 copies all values. 
+	 * This does not apply to lazy loads, see #setLazy(bool), 
+	 * nor to files included. 
+	 */
+        void setLargeValueThreshold(std::size_t threshold)
+        {
+            largeValueThreshold_ = threshold;
+        }
+
+        /**
+	 * Decodes all sections not yet decoded after a lazy load 
+	 * and returns the first failure in any section, 
+	 * also in one decoded before on access. 
+	 * Without lazy load, this returns success. 
+	 */
+        DecEncResult tryValidate()
+        {
+            decodeAllLazy();
+            return lazyResult_;
+        }
+
+        /**
+	 * Drops all included files cached. 
+	 * This is never necessary for correctness, 
+	 * as a file changed in size or modification time is read again. 
+	 */
+        static void clearIncludeCache()
+        {
+            includeCache().clear();
+        }
+
+        /**
+	 * Bounds the size in bytes of the tokens of included files cached, 
+	 * by default #INCLUDE_CACHE_CAPACITY. 
+	 * If 0, included files are read each time. 
+	 */
+        static void setIncludeCacheCapacity(std::size_t capacity)
+        {
+            includeCache().setCapacity(capacity);
+        }
+
+        /**
+	 * Enables caching decoded files per process 
+	 * for #tryLoad(const std::string&) and #tryLoadShared 
+	 * if \p capacity is not 0, which is the default. 
+	 * An unchanged file is then decoded once 
+	 * and reloading it costs a stat on the file 
+	 * and on each file it includes. 
+	 * A file is identified by device and inode, 
+	 * so different paths to the same file share an entry. 
+	 * An entry is used only by an IniFile 
+	 * with the same sections, separator, comment character 
+	 * and include directive. 
+	 * On a hit #tryLoad(const std::string&) still copies 
+	 * all sections and fields of the file cached; 
+	 * #tryLoadShared hands out the file cached itself without copying. 
+	 *
+	 * @param capacity
+	 *    bounds the sum of the sizes in bytes of the files cached 
+	 *    including the files they include; 
+	 *    the least recently used files are evicted first. 
+	 */
+        static void setLoadCacheCapacity(std::size_t capacity)
+        {
+            loadCache().setCapacity(capacity);
+        }
+
+        /**
+	 * Drops all decoded files cached, see #setLoadCacheCapacity. 
+	 * This is never necessary for correctness. 
+	 */
+        static void clearLoadCache()
+        {
+            loadCache().clear();
+        }
+
+
+             IniSection & operator[](std::string_view key)
+        {
+	    if (numUndecoded_ != 0)
+	    {
+	        t_ResVMap<IniSection>::iterator found = map.find(key);
+	        if (found != map.end())
+	        {
+		    decodeLazy(found - map.begin());
+		    return found->second;
+		}
+	    }
+	    return map[key];
+	}
+
+        /**
+	 * Returns the section named \p section or NULL if there is none. 
+	 * Unlike #operator[](std::string_view) this does not insert anything 
+	 * and does not allocate, 
+	 * but a section loaded lazily is decoded. 
+	 */
+        const IniSection *find(std::string_view section) const
+        {
+	    t_ResVMap<IniSection>::const_iterator found = map.find(section);
+	    if (found == map.end())
+	        return NULL;
+	    decodeLazy(found - map.begin());
+	    return &found->second;
+	}
+
+        /**
+	 * Returns the field with key \p key in section \p section 
+	 * or NULL if there is none. 
+	 * Like #find(std::string_view) this does not insert anything. 
+	 */
+        const IniField *find(std::string_view section,
+			     std::string_view key) const
+        {
+	    const IniSection *found = find(section);
+	    return found == NULL ? NULL : found->find(key);
+	}
+
+        /**
+	 * Returns the value of the field with key \p key in section \p section 
+	 * as a \p T or \p defaultValue if there is no such field 
+	 * or if it is no \p T. 
+	 * Unlike <c>(*this)[section][key].orDefault(defaultValue)</c> 
+	 * this does neither insert anything nor allocate on a miss 
+	 * and works on a const IniFile. 
+	 */
+        template<typename T>
+        T get(std::string_view section, std::string_view key,
+	      T defaultValue) const
+        {
+	    const IniSection *found = find(section);
+	    return found == NULL
+	        ? defaultValue : found->get(key, std::move(defaultValue));
+	}
+
+        /**
+	 * Resolves the field with key \p key in section \p section 
+	 * into a handle for repeated access by #tryAt(const FieldHandle&). 
+	 * If there is no such field, the handle is not resolved. 
+	 * Like #find(std::string_view) this does not insert anything. 
+	 */
+        FieldHandle resolve(std::string_view section,
+			    std::string_view key) const
+        {
+	    FieldHandle handle;
+	    t_ResVMap<IniSection>::const_iterator foundSec = map.find(section);
+	    if (foundSec == map.end())
+	        return handle;
+	    decodeLazy(foundSec - map.begin());
+	    const t_ResVMap<IniField> &fields = foundSec->second.map;
+	    t_ResVMap<IniField>::const_iterator foundField = fields.find(key);
+	    if (foundField == fields.end())
+	        return handle;
+	    handle.idxSec_   = foundSec   - map.begin();
+	    handle.idxField_ = foundField - fields.begin();
+	    handle.generation_ = generation_.value;
+	    return handle;
+	}
+
+        /**
+	 * Returns the field \p handle refers to 
+	 * or NULL if it is not resolved or stale. 
+	 * This accesses sections and fields by position 
+	 * without comparing names. 
+	 */
+        IniField *tryAt(const FieldHandle &handle)
+        {
+	    return const_cast<IniField *>
+	      (static_cast<const t_IniFile &>(*this).tryAt(handle));
+	}
+
+        const IniField *tryAt(const FieldHandle &handle) const
+        {
+	    if (handle.generation_ != generation_.value
+		|| handle.idxSec_ >= map.size())
+	        return NULL;
+	    const t_ResVMap<IniField> &fields =
+	      (map.begin() + handle.idxSec_)->second.map;
+	    if (handle.idxField_ >= fields.size())
+	        return NULL;
+	    return &(fields.begin() + handle.idxField_)->second;
+	}
 
-    // class LightweightMap
-    // {
-    // };
+#ifndef THROW_PREVENTED
+        /**
+	 * Returns the field \p handle refers to 
+	 * like #tryAt(const FieldHandle&) 
+	 * but throws an out_of_range exception 
+	 * if it is not resolved or stale. 
+	 */
+        IniField &at(const FieldHandle &handle)
+        {
+	    IniField *field = tryAt(handle);
+	    if (field == NULL)
+	        throw std::out_of_range("field handle not resolved or stale");
+	    return *field;
+	}
 
+        const IniField &at(const FieldHandle &handle) const
+        {
+	    const IniField *field = tryAt(handle);
+	    if (field == NULL)
+	        throw std::out_of_range("field handle not resolved or stale");
+	    return *field;
+	}
+#endif
 
-    class IniFile
-    {
-    public:
-      	class DecEncResult
+        // TBD: in the long run this shall be removed:
+        // this method is not used in application, but for testing. 
+        // In a validating parser, only a bool valued check is necessary. 
+        unsigned int size() const
+        {
+	    return map.size();
+        }
+
+        /**
+	 * Returns a range over the sections in the order of insertion 
+	 * yielding SectionViews without copying anything: 
+	 * <c>for (ini::SectionView sec : inif.sections())</c> 
+	 * and then <c>sec.section.fields()</c>. 
+	 * Sections loaded lazily are all decoded first. 
+	 */
+        t_ViewRange<IniSection, SectionView> sections() const
+        {
+	    decodeAllLazy();
+	    return t_ViewRange<IniSection, SectionView>(map);
+	}
+
+        /**
+	 * Extracts the fields described by \p items into their destinations 
+	 * in a single pass over this IniFile 
+	 * instead of one lookup per field. 
+	 * Unlike #operator[](std::string_view) this does not insert anything. 
+	 * Missing and malformed fields do not stop extraction 
+	 * but are all reported in the result; 
+	 * their destinations keep the default values. 
+	 * If several items refer to the same field, all are filled. 
+	 *
+	 * @param items
+	 *    items created by 
+	 *    #extractItem(std::string_view, std::string_view, T&, const T&). 
+	 * @param numItems
+	 *    the number of items. 
+	 */
+        ExtractResult extract(const ExtractItem *items,
+                              std::size_t numItems) const
+        {
+            ExtractResult result;
+            // sort the items by section and key 
+            // to find the ones of a section or a field by bisection 
+            std::vector<std::size_t> order(numItems);
+            for (std::size_t idx = 0; idx < numItems; idx++)
+                order[idx] = idx;
+            std::sort(order.begin(), order.end(),
+                      [items](std::size_t idx1, std::size_t idx2)
+                      {
+                          return items[idx1].section != items[idx2].section
+                              ? items[idx1].section < items[idx2].section
+                              : items[idx1].key < items[idx2].key;
+                      });
+            std::vector<bool> found(numItems, false);
+
+            decodeAllLazy();
+            for (const auto &secPair : map)
+            {
+                std::string_view secName = secPair.first;
+                std::vector<std::size_t>::iterator secBegin =
+                    std::lower_bound(order.begin(), order.end(), secName,
+                                     [items](std::size_t idx, std::string_view name)
+                                     {
+                                         return items[idx].section < name;
+                                     });
+                std::vector<std::size_t>::iterator secEnd =
+                    std::upper_bound(secBegin, order.end(), secName,
+                                     [items](std::string_view name, std::size_t idx)
+                                     {
+                                         return name < items[idx].section;
+                                     });
+                if (secBegin == secEnd)
+                    continue;
+
+                for (const auto &fieldPair : secPair.second.map)
+                {
+                    std::string_view key = fieldPair.first;
+                    std::vector<std::size_t>::iterator item =
+                        std::lower_bound(secBegin, secEnd, key,
+                                         [items](std::size_t idx, std::string_view k)
+                                         {
+                                             return items[idx].key < k;
+                                         });
+                    for (; item != secEnd && items[*item].key == key; item++)
+                    {
+                        found[*item] = true;
+                        if (!items[*item].convert(fieldPair.second,
+                                                  items[*item].dest))
+                            result.failures_.push_back
+                                (ExtractFailure{*item, FIELD_CONVERSION_FAILED});
+                    }
+                }
+            }
+
+            for (std::size_t idx = 0; idx < numItems; idx++)
+            {
+                if (!found[idx])
+                    result.failures_.push_back
+                        (ExtractFailure{idx, FIELD_NOT_FOUND});
+            }
+            std::sort(result.failures_.begin(), result.failures_.end(),
+                      [](const ExtractFailure &fail1, const ExtractFailure &fail2)
+                      {
+                          return fail1.index < fail2.index;
+                      });
+            return result;
+        }
+
+        ExtractResult extract(const std::vector<ExtractItem> &items) const
+        {
+            return extract(items.data(), items.size());
+        }
+
+        ExtractResult extract(std::initializer_list<ExtractItem> items) const
+        {
+            return extract(items.begin(), items.size());
+        }
+
+
+        /**
+	 * 
+	 */
+        class InStreamInterface
 	{
-	  friend IniFile;
+	public:
+	  virtual bool isOpen() = 0;
+	  virtual bool getLine(std::string &line) = 0;
+	  virtual bool bad() = 0;
+	  virtual int close() = 0;
+	}; // class InStreamInterface
+
+        /**
+	 * Reads lines from a text given as a view, both with and without streams, 
+	 * copying neither the text nor, if the capacity suffices, the lines. 
+	 * The text must stay valid while reading. 
+	 */
+        class InStringViewStream final : public InStreamInterface
+        {
 	private:
-	    /**
-	     * This is DecEncErrorCode#NO_FAILURE if all ok so far. 
-	     */
-	    DecEncErrorCode errorCode;
-	    /**
-	     * The line number where a failure occurs 
-	     * during decode/encode, 
-	     * line numbers starting with 1. 
-	     * This is immaterial if no failure occurred (yet). 
-	     * At the end of successful encode/decode 
-	     * it is the last line enumber. 
-	     * It is set to 0 if the failure does not correspond 
-	     * with a line number, 
-	     * e.g. if open file fails. 
-	     */
-	    unsigned int lineNumber;
-	    /*
-	     * This is <c>null</c> if reading from/writing to 
-	     * a stream without file. 
-	     */
-	    //std::string fileName;
-	    
+	    std::string_view str_;
+	    std::size_t pos_;
+	public:
+	    InStringViewStream(std::string_view str) : str_(str), pos_(0)
+	    {
+	    }
+	    bool isOpen()
+	    {
+	        return true;
+	    }
+	    // like std::getline a last line need not end with a newline 
+	    bool getLine(std::string &line)
+	    {
+	        if (pos_ >= str_.length())
+		    return false;
+		std::size_t end = str_.find('\n', pos_);
+		if (end == std::string_view::npos)
+		    end = str_.length();
+		line.assign(str_.substr(pos_, end - pos_));
+		pos_ = end + 1;
+		return true;
+	    }
+	    bool bad()
+	    {
+	        return false;
+	    }
+	    int close()
+	    {
+	        return 0;
+	    }
+	}; // class InStringViewStream
 
-	protected:
+#ifdef SSTREAM_PREVENTED
+      // TBD: clarify whether here also out of memory may occur
+      // TBD: clarify memory leaks 
+        /**
+	 * 
+	 */
+        class InStringStreamNS final : public InStreamInterface
+        {
+	private:
+	  char* str_;
+	public:
+	  InStringStreamNS(std::string str)
+	    {
+	      int n = str.length();
+	      str_ = (char*)malloc((n + 1)*sizeof(char)); 
+	      strcpy(str_, str.c_str());
+	    }
+	    bool isOpen()
+	    {
+	        return true;
+	    }
+	    bool getLine(std::string &line)
+	    {
+		// std::cout << "InStringStreamNS.getLine str_ \n"
+		// 	  << str_ << "'\n" << std::endl;
+	        char* loc = strchr(str_, '\n');
+	        if (loc == NULL)
+	        {
+		    // no newline found 
+		    if (*str_ == '\0')
+		        return false;
+		    std::string myline(str_);
+		    line = myline;// TBD: eliminate hack 
+		    //line(str_);
+		    str_ = strchr(str_, '\0');
+		    return true;
+		}
+		(*loc) = '\0';
+		std::string myline(str_);
+		str_=loc+1;
+		line = myline;// TBD: eliminate hack 
+	        return true;
+	    }
+	    bool bad()
+	    {
+	        return false;
+	    }
+	    int close()
+	    {
+	        return 0;
+	    }
+	}; // class InStringStreamNS
 
-	    DecEncResult set(DecEncErrorCode errorCode)
+
+
+     // TBD: unify InFileStreamNS and OutFileStreamNS
+        /**
+	 * 
+	 */
+        class InFileStreamNS final : public InStreamInterface
+        {
+	private:
+	    // lines longer than that are read in pieces 
+	    static const int LEN_BUFF = 4096;
+	    FILE* file_;
+	    char buff[LEN_BUFF];
+	    bool badBit;
+	public:
+	    InFileStreamNS(const std::string fName) //: str_(str)
 	    {
-	     	this->errorCode  = errorCode;
-		return *this;
+	        file_ = fopen(fName.c_str(), "r");
+		 // std::cout << "InFileStreamNS.open '"
+		 // 	  << fName << "'" << std::endl;
+		badBit = false;
 	    }
-	    void reset()
+	    bool isOpen()
 	    {
-	      this->errorCode  = NO_FAILURE;
-	      this->lineNumber = 0;
+	        return file_ != NULL;
 	    }
-	    void incLineNo()
+	    bool getLine(std::string &line)
 	    {
-	        lineNumber++;
+	        int ch;
+		// skip empty lines 
+		while ((ch = getc(file_)) == '\n')
+		    ;
+		if (ch == EOF)
+		{
+		    badBit = ferror(file_) != 0;
+		    return false;
+		}
+		ungetc(ch, file_);
+
+		// read lines closed by newline or eof in pieces of any length 
+		line.clear();
+		while (fgets(buff, LEN_BUFF, file_) != NULL)
+		{
+		    std::size_t len = strlen(buff);
+		    if (len != 0 && buff[len - 1] == '\n')
+		    {
+		        line.append(buff, len - 1);
+			return true;
+		    }
+		    line.append(buff, len);
+		}
+		if (ferror(file_))
+		{
+		    badBit = true;
+		    return false;
+		}
+	        return true;
+	    }
+	    bool bad()
+	    {
+	        return badBit;
+	    }
+	    int close()
+	    {
+	        int res = fclose(file_);
+		file_ = NULL;
+	        return res;
 	    }
+	}; // class InFileStreamNS
+
+#else
+      // T is the kind of stream under consideration:
+        // ifstream or istringstream
+        /**
+	 * 
+	 */
+        template<class T>
+	class t_InStream : public InStreamInterface
+	{
+	protected:
+	    T &iStream_;
 	public:
-	    DecEncResult() 
+	    t_InStream(T &iStream) : iStream_(iStream)
+	    {
+	    }
+	    // overwritten for InFileStream
+	    bool isOpen()
+	    {
+	      return true;
+	    }
+	    // final for the decoder to call it directly 
+	    bool getLine(std::string &line) final
+	    {
+	      return (bool)std::getline(iStream_, line, '\n');
+	    }
+	    // TBC: can this be false for an istringstream??
+	    bool bad() final
+	    {
+	        return iStream_.bad();
+	    }
+	   // overwritten for InFileStream
+	  // TBD: this shall be eliminated
+	  // just to avoid tryDecode on general streams
+	  // which may not be appropriate 
+	    int close()
+	    {
+	      //iStream_.close();
+	        return 0;
+	    }
+	};  // class t_InStream
+
+        /**
+	 * 
+	 */
+        class InStringStream final : public t_InStream<std::istringstream>
+        {
+	public:
+	
+	    InStringStream(std::istringstream &iStream)
+	      : t_InStream<std::istringstream>(iStream)
 	    {
-	      reset();
 	    }
-	    DecEncErrorCode getErrorCode()
+	    // }
+	    // bool isOpen()
+	    // {
+	    //   return true;
+	    // }
+
+	  // TBD: this shall be activated instead of template 
+	    // int close()
+	    // {
+	    //   //iStream_.close();
+	    //     return 0;
+	    // }
+	};  // class InStringStream
+
+              /**
+	 * 
+	 */
+      class InFileStream final : public t_InStream<std::ifstream>
+      {
+	public:
+	    InFileStream(std::ifstream &iStream)
+	      : t_InStream<std::ifstream>(iStream)
 	    {
-	        return errorCode;
 	    }
-	    int getLineNumber()
+	    bool isOpen()
 	    {
-	        return lineNumber;
+	      return this->iStream_.is_open();
 	    }
-	    bool isOk()
+	    int close()
 	    {
-	      return this->errorCode == NO_FAILURE;
+	        this->iStream_.close();
+		return 0;
 	    }
+	};  // class InFileStream
+
+#endif
+
 
-	}; // class DecEncResult
 
     private:
-	const static char SEC_START = '[';
- 	const static char SEC_END   = ']';
 
-        DecEncResult deResult;
-        t_ResVMap<IniSection> map;
-     
-      
-      // TBD: rework
-      // This is preliminary:
-      // an array with one entry per section
-      // specifying the number of keys in a section.
-      // This is the first step towards a validating parser
-      // but also to elimination of the vector class. 
-      std::vector<unsigned int> lenSections_;
+        /**
+	 * Handler for #tryDecodeWith(Source&, Handler&) 
+	 * which fills #map with the sections and fields found 
+	 * and checks them against #lenSections_. 
+	 * As #lenSections_ gives the numbers of sections and fields, 
+	 * storage is reserved up front in a single chunk each. 
+	 * As entries of a t_ResVMap never move, 
+	 * names may be referred to by views, 
+	 * which serve to check large sections for uniqueness 
+	 * by hashing instead of a linear search. 
+	 */
+        class MapHandler
+        {
+        private:
+            // above this number of names expected 
+            // uniqueness is checked by hashing 
+            static const unsigned int LINEAR_SEARCH_LIMIT = 16;
+
+            t_IniFile &iniFile_;
+            // if not NULL, the sections rejected are skipped 
+            const SectionFilter *filter_;
+            unsigned int idxSec_;
+            unsigned int idxFieldInSec_;
+            IniSection *currentSection_;
+            bool hashSections_;
+            bool hashKeys_;
+            std::unordered_set<std::string_view> secNames_;
+            // the names of the sections skipped which are not in the map 
+            std::unordered_set<std::string> skippedNames_;
+            std::unordered_set<std::string_view> keys_;
+        public:
+            MapHandler(t_IniFile &iniFile, const SectionFilter *filter = NULL)
+              : iniFile_(iniFile),
+                filter_(filter),
+                idxSec_(-1),
+                // superfluous, only to cause error if used uninitilized
+                // (also to avoid compiler warnings)
+                idxFieldInSec_(-1),
+                currentSection_(NULL),
+                hashSections_(false),
+                hashKeys_(false)
+            {}
+
+            void start()
+            {
+                iniFile_.map.clear();
+                iniFile_.clearLazy();
+                iniFile_.map.reserve(iniFile_.lenSections_.size());
+                hashSections_ =
+                    iniFile_.lenSections_.size() > LINEAR_SEARCH_LIMIT;
+            }
 
-        char fieldSep_;
-        char comment_;
+            DecEncErrorCode section(std::string &secName)
+            {
+                // check if section name occurred before, 
+                // also among the sections skipped 
+                bool skipped = filter_ != NULL && !filter_->accepts(secName);
+                if (skipped ? !skippedNames_.insert(secName).second
+                    : hashSections_ ? secNames_.count(secName) != 0
+                                    : iniFile_.map.contains(secName))
+                    return SECTION_NOT_UNIQUE;
+
+                idxSec_++;
+                if (idxSec_ >= iniFile_.lenSections_.size())
+                    return SECTION_UNEXPECTED;
+                idxFieldInSec_ = 0;
+                if (skipped)
+                {
+                    currentSection_ = NULL;
+                    return NO_FAILURE;
+                }
+                unsigned int lenSection = iniFile_.lenSections_[idxSec_];
+                currentSection_ = &iniFile_.map.append(secName);
+                currentSection_->map.reserve(lenSection);
+                if (hashSections_)
+                    secNames_.insert((iniFile_.map.end() - 1)->first);
+                hashKeys_ = lenSection > LINEAR_SEARCH_LIMIT;
+                keys_.clear();
+                return NO_FAILURE;
+            }
 
-        static void trim(std::string &str)
+            // the value is a std::string or an IniField 
+            template<typename V>
+            DecEncErrorCode field(std::string &key, V &value)
+            {
+                // skipped 
+                if (currentSection_ == NULL)
+                    return NO_FAILURE;
+                // check if key name is  occurred before within the section
+                if (hashKeys_ ? keys_.count(key) != 0
+                              : currentSection_->map.contains(key))
+                    return FIELD_NOT_UNIQUE_IN_SECTION;
+
+                if (idxFieldInSec_ >= iniFile_.lenSections_[idxSec_])
+                    return FIELD_UNEXPECTED_IN_SECTION;
+                idxFieldInSec_++;
+
+                currentSection_->map.emplace(key, std::move(value));
+                if (hashKeys_)
+                    keys_.insert((currentSection_->map.end() - 1)->first);
+                return NO_FAILURE;
+            }
+        }; // class MapHandler
+
+        /**
+	 * Handler for #tryDecodeWith(Source&, Handler&) 
+	 * which writes the fields found directly into the members of a struct 
+	 * of type \p S as bound by \p Schema. 
+	 * No map is built. 
+	 * The schema takes the role of #lenSections_: 
+	 * sections and fields not bound are unexpected. 
+	 */
+        template<class S, class Schema>
+        class t_BindingHandler
         {
-            size_t startpos = str.find_first_not_of(" \t");
-            if (std::string::npos != startpos)
+        private:
+            const Schema &schema_;
+            S &obj_;
+            std::array<bool, Schema::NUM_SECTIONS> seenSections_;
+            std::array<bool, Schema::MAX_FIELDS> seenFields_;
+            std::size_t idxSec_;
+        public:
+            t_BindingHandler(const Schema &schema, S &obj)
+              : schema_(schema), obj_(obj), idxSec_(Schema::NUM_SECTIONS)
+            {}
+
+            void start()
             {
-                size_t endpos = str.find_last_not_of(" \t");
-                str = str.substr(startpos, endpos - startpos + 1);
+                seenSections_.fill(false);
             }
-            else
-                str = "";
+
+            DecEncErrorCode section(std::string &secName)
+            {
+                idxSec_ = schema_.indexOf(secName);
+                if (idxSec_ == Schema::NUM_SECTIONS)
+                    return SECTION_UNEXPECTED;
+                if (seenSections_[idxSec_])
+                    return SECTION_NOT_UNIQUE;
+                seenSections_[idxSec_] = true;
+                seenFields_.fill(false);
+                return NO_FAILURE;
+            }
+
+            DecEncErrorCode field(std::string &key, std::string &value)
+            {
+                std::size_t idxField = schema_.indexOf(idxSec_, key);
+                if (idxField == Schema::MAX_FIELDS)
+                    return FIELD_UNEXPECTED_IN_SECTION;
+                if (seenFields_[idxField])
+                    return FIELD_NOT_UNIQUE_IN_SECTION;
+                seenFields_[idxField] = true;
+                if (!schema_.assign(idxSec_, idxField, value, obj_))
+                    return FIELD_CONVERSION_FAILED;
+                return NO_FAILURE;
+            }
+        }; // class t_BindingHandler
+
+        /**
+	 * A section, a field or an include directive found by #scanLine. 
+	 */
+        class Token
+        {
+        public:
+            enum Kind
+            {
+                // empty line or comment 
+                NONE,
+                SECTION,
+                FIELD,
+                INCLUDE
+            };
+            Kind kind;
+            unsigned int lineNumber;
+            // the name of the section, the key of the field 
+            // or the path of the included file 
+            std::string name;
+            // the value of the field 
+            std::string value;
+        }; // class Token
+
+
+        /**
+	 * The tokens of an included file 
+	 * together with the grammar they depend on. 
+	 */
+        class TokenizedFile
+        {
+        public:
+            char fieldSep;
+            char comment;
+            std::string includeDirective;
+            std::vector<Token> tokens;
+        }; // class TokenizedFile
+
+        /**
+	 * Included files by default are cached up to this size in bytes. 
+	 */
+        static const std::size_t INCLUDE_CACHE_CAPACITY = 64*1024*1024;
+
+        /**
+	 * Caches the tokens of included files per process, 
+	 * so that a file included by many files is read and tokenized once. 
+	 */
+        static t_FileCache<TokenizedFile> &includeCache()
+        {
+            static t_FileCache<TokenizedFile> cache(INCLUDE_CACHE_CAPACITY);
+            return cache;
         }
 
-    public:
+        /**
+	 * Returns the tokens of the file \p path with state \p stamp 
+	 * from #includeCache() or tokenizes it. 
+	 * If this fails, returns NULL 
+	 * and sets \p errorCode and \p lineNumber. 
+	 */
+        std::shared_ptr<const TokenizedFile>
+	tokenizeCached(const std::string &path,
+		       const FileStamp &stamp,
+		       StatRecorder &recorder,
+		       DecEncErrorCode &errorCode,
+		       unsigned int &lineNumber)
+        {
+            lineNumber = 0;
+            return includeCache().get(stamp,
+                [this](const TokenizedFile &file)
+                {
+                    return file.fieldSep == fieldSep_
+                        && file.comment == comment_
+                        && file.includeDirective == includeDirective_;
+                },
+                [&](std::size_t &size)
+                {
+                    std::shared_ptr<TokenizedFile> file =
+                        std::make_shared<TokenizedFile>();
+                    file->fieldSep = fieldSep_;
+                    file->comment = comment_;
+                    file->includeDirective = includeDirective_;
+                    errorCode = tokenize(path, file->tokens,
+                                         recorder, lineNumber);
+                    if (errorCode != NO_FAILURE)
+                        return std::shared_ptr<const TokenizedFile>();
+                    size = sizeof(TokenizedFile);
+                    for (const Token &token : file->tokens)
+                        size += sizeof(Token)
+                            + token.name.capacity() + token.value.capacity();
+                    return std::shared_ptr<const TokenizedFile>(file);
+                });
+        }
 
-	
-      IniFile(std::vector<unsigned int> lenSections)
-	: IniFile(lenSections, '=', '#')
-        {}
+        /**
+	 * Returns \p path relative to the directory of \p fileName 
+	 * unless \p path is absolute. 
+	 * If \p fileName is empty, \p path is relative 
+	 * to the current working directory. 
+	 */
+        static std::string resolvePath(std::string_view fileName,
+                                       std::string_view path)
+        {
+#ifdef _WIN32
+            const char *separators = "/\\";
+            bool isAbsolute = (!path.empty() && (path[0] == '/' || path[0] == '\\'))
+                || (path.size() > 1 && path[1] == ':');
+#else
+            const char *separators = "/";
+            bool isAbsolute = !path.empty() && path[0] == '/';
+#endif
+            std::size_t pos = fileName.find_last_of(separators);
+            if (isAbsolute || pos == std::string_view::npos)
+                return std::string(path);
+            std::string res(fileName.substr(0, pos + 1));
+            res += path;
+            return res;
+        }
 
-      IniFile(std::vector<unsigned int> lenSections,
-	      const char fieldSep,
-	      const char comment)
-	: lenSections_(lenSections), fieldSep_(fieldSep), comment_(comment)
-        {}
+        /**
+	 * Trims \p line in place and scans it into \p token 
+	 * if it is a section, a field or an include directive; 
+	 * else the kind of \p token is Token#NONE. 
+	 * Returns the failure if \p line violates the grammar, 
+	 * else DecEncErrorCode#NO_FAILURE. 
+	 * Whether a field is in a section is up to the caller. 
+	 */
+        DecEncErrorCode scanLine(std::string &line, Token &token,
+                                 StatRecorder &recorder) const
+        {
+            token.kind = Token::NONE;
+            // lines may also end with \r\n 
+            if (Dialect::ACCEPT_CRLF
+                && !line.empty() && line[line.size() - 1] == '\r')
+                line.erase(line.size() - 1);
+            trim(line);
+
+            // skip if line is empty 
+            if (line.size() == 0)
+                return NO_FAILURE;
+
+            // an include directive may start with the comment character 
+            std::size_t lenDirective = includeDirective_.length();
+            if (lenDirective != 0
+                && line.compare(0, lenDirective, includeDirective_) == 0
+                && (line.length() == lenDirective
+                    || t_BlankTable<Dialect>::isBlank(line[lenDirective])))
+            {
+                std::string_view path = t_BlankTable<Dialect>::trim
+                    (std::string_view(line).substr(lenDirective));
+                if (path.empty())
+                    return ILLEGAL_LINE;
+                token.kind = Token::INCLUDE;
+                token.name.assign(path);
+                return NO_FAILURE;
+            }
 
-        ~IniFile()
-        {}
+            // skip if line is a comment 
+            if (line[0] == commentChar())
+            {
+                recorder.comment();
+                return NO_FAILURE;
+            }
 
+            if (line[0] == SEC_START)
+            {
+                // line defines a section
+                // check if the section is also closed on same line
+                std::size_t pos = line.find(SEC_END);
+                if(pos == std::string::npos)
+                    return SECTION_NOT_CLOSED;
+                // check if the section name is empty
+                if(pos == 1)
+                    return SECTION_NAME_EMPTY;
+                // check if there is text
+                // between closing bracket and newline 
+                if(pos + 1 != line.length())
+                    return SECTION_TEXT_AFTER;
+                // retrieve section name
+                token.kind = Token::SECTION;
+                token.name.assign(line, 1, pos - 1);
+                return NO_FAILURE;
+            }
 
+            // find key value separator
+            std::size_t pos = line.find(fieldSepChar());
+            if(pos == std::string::npos)
+                return ILLEGAL_LINE;
+            // line is a field definition
+            // retrieve field key and value
+            // trimming views before copying 
+            std::string_view lineView(line);
+            token.kind = Token::FIELD;
+            token.name.assign(t_BlankTable<Dialect>::trim(lineView.substr(0, pos)));
+            token.value.assign(t_BlankTable<Dialect>::trim(lineView.substr(pos + 1)));
+            return NO_FAILURE;
+        }
 
- 
+        /**
+	 * Implements ini#findValue with the grammar of this IniFile 
+	 * but ignoring #includeDirective_. 
+	 */
+        template<class Source>
+        DecEncErrorCode tryFindValue(Source &iStream,
+                                     std::string_view section,
+                                     std::string_view key,
+                                     std::string &value) const
+        {
+            if (!iStream.isOpen())
+                return STREAM_OPENR_FAILED;
+            DecEncResult result;
+            StatRecorder recorder(result);
+            bool inSection = false;
+            bool inSearched = false;
+            Token token;
+            std::string line;
+            while (iStream.getLine(line))
+            {
+                // fields of other sections are not decoded 
+                if (inSection && !inSearched)
+                {
+                    std::string_view trimmed = t_BlankTable<Dialect>::trim(line);
+                    if (trimmed.empty() || trimmed[0] != SEC_START)
+                        continue;
+                }
+                DecEncErrorCode errorCode = scanLine(line, token, recorder);
+                if (errorCode != NO_FAILURE)
+                    return errorCode;
+                switch (token.kind)
+                {
+                case Token::SECTION:
+                    // as sections are unique 
+                    if (inSearched)
+                        return FIELD_NOT_FOUND;
+                    inSection = true;
+                    inSearched = token.name == section;
+                    break;
+                case Token::FIELD:
+                    if (!inSection)
+                        return FIELD_WITHOUT_SECTION;
+                    if (token.name == key)
+                    {
+                        value = std::move(token.value);
+                        return NO_FAILURE;
+                    }
+                    break;
+                default:
+                    break;
+                }
+            }
+            return iStream.bad() ? STREAM_READ_FAILED : FIELD_NOT_FOUND;
+        }
+
+        /**
+	 * Reads the file \p path and scans it into \p tokens 
+	 * omitting empty lines and comments. 
+	 * If this fails, the line number is stored in \p lineNumber. 
+	 */
+        DecEncErrorCode tokenize(const std::string &path,
+                                 std::vector<Token> &tokens,
+                                 StatRecorder &recorder,
+                                 unsigned int &lineNumber) const
+        {
+#ifdef SSTREAM_PREVENTED
+            InFileStreamNS ifs(path);
+#else
+            std::ifstream is(path.c_str());
+            InFileStream ifs(is);
+#endif
+            lineNumber = 0;
+            if (!ifs.isOpen())
+                return STREAM_OPENR_FAILED;
+            Token token;
+            std::string line;
+            for (lineNumber = 1; ; lineNumber++)
+            {
+                recorder.startPhase();
+                bool hasLine = ifs.getLine(line);
+                recorder.stopIo();
+                if (!hasLine)
+                    break;
+                recorder.line(line.size());
+                DecEncErrorCode errorCode = scanLine(line, token, recorder);
+                if (errorCode != NO_FAILURE)
+                    return errorCode;
+                if (token.kind == Token::NONE)
+                    continue;
+                token.lineNumber = lineNumber;
+                tokens.push_back(token);
+            }
+            if (ifs.bad())
+                return STREAM_READ_FAILED;
+            ifs.close();
+            return NO_FAILURE;
+        }
 
+        /**
+	 * Hands \p token over to \p handler 
+	 * or, for an include directive, the tokens of the included file 
+	 * resolved relative to \p fileName. 
+	 * \p inSection tells whether a section was opened before 
+	 * and \p includeStack holds the files being included 
+	 * to detect cycles. 
+	 */
+        template<class Handler>
+        DecEncErrorCode dispatch(Token &token,
+                                 Handler &handler,
+                                 std::string_view fileName,
+                                 bool &inSection,
+                                 std::vector<FileStamp> &includeStack,
+                                 StatRecorder &recorder)
+        {
+            DecEncErrorCode errorCode;
+            switch (token.kind)
+            {
+            case Token::NONE:
+                return NO_FAILURE;
+            case Token::SECTION:
+                recorder.section();
+                recorder.startPhase();
+                errorCode = handler.section(token.name);
+                recorder.stopInsert();
+                if (errorCode != NO_FAILURE)
+                    return errorCode;
+                inSection = true;
+                return NO_FAILURE;
+            case Token::FIELD:
+                // check if section was already opened
+                if(!inSection)
+                    return FIELD_WITHOUT_SECTION;
+                recorder.field();
+                recorder.startPhase();
+                errorCode = handler.field(token.name, token.value);
+                recorder.stopInsert();
+                return errorCode;
+            case Token::INCLUDE:
+                return include(resolvePath(fileName, token.name), handler,
+                               inSection, includeStack, recorder);
+            }
+            return NO_FAILURE;
+        }
 
-# ifndef THROW_PREVENTED
-        IniFile(const std::string &filename,
-		std::vector<unsigned int> lenSections,
-		const char fieldSep,
-		const char comment)
-	  : IniFile(lenSections, fieldSep, comment)
+        /**
+	 * Hands the tokens of the file \p path over to \p handler 
+	 * as if its lines were in place of the include directive. 
+	 * On failure in \p path 
+	 * DecEncResult#lineNumber refers to the line in \p path, 
+	 * else to the line of the include directive. 
+	 */
+        template<class Handler>
+        DecEncErrorCode include(const std::string &path,
+                                Handler &handler,
+                                bool &inSection,
+                                std::vector<FileStamp> &includeStack,
+                                StatRecorder &recorder)
         {
-	    load(filename);
+            FileStamp stamp;
+            if (!stamp.read(path))
+                return STREAM_OPENR_FAILED;
+            if (includedFiles_ != NULL)
+                includedFiles_->emplace_back(path, stamp);
+            for (const FileStamp &including : includeStack)
+            {
+                if (including.sameFile(stamp))
+                    return INCLUDE_CYCLIC;
+            }
+
+            DecEncErrorCode errorCode = NO_FAILURE;
+            unsigned int lineNumber;
+            std::shared_ptr<const TokenizedFile> file =
+                tokenizeCached(path, stamp, recorder, errorCode, lineNumber);
+            if (file == NULL)
+            {
+                if (lineNumber != 0)
+                    deResult.lineNumber = lineNumber;
+                return errorCode;
+            }
+
+            unsigned int outerLineNumber = deResult.lineNumber;
+            includeStack.push_back(stamp);
+            // copied as the handler may move from it 
+            Token token;
+            for (const Token &cached : file->tokens)
+            {
+                deResult.lineNumber = cached.lineNumber;
+                token = cached;
+                errorCode = dispatch(token, handler, path,
+                                     inSection, includeStack, recorder);
+                if (errorCode != NO_FAILURE)
+                    return errorCode;
+            }
+            includeStack.pop_back();
+            deResult.lineNumber = outerLineNumber;
+            return NO_FAILURE;
         }
 
- # ifndef SSTREAM_PREVENTED
-       IniFile(std::istream &is,
-	       std::vector<unsigned int> lenSections,
-	       const char fieldSep,
-	       const char comment)
-	  : IniFile(lenSections, fieldSep, comment)
+        /**
+	 * Decodes \p iStream line by line checking the grammar 
+	 * and hands each section and each field over to \p handler 
+	 * which checks and stores them. 
+	 * The handler provides 
+	 * - <c>start()</c> invoked before the first line is read, 
+	 * - <c>section(secName)</c> for each section and 
+	 * - <c>field(key, value)</c> for each field, 
+	 * the latter two returning DecEncErrorCode#NO_FAILURE 
+	 * or the failure to be reported. 
+	 * Key and value may be moved from by the handler. 
+	 * Include directives are resolved relative to \p fileName, 
+	 * the name of the file \p iStream reads, if any. 
+	 * The source \p iStream is a template parameter, see #t_IsLineSource, 
+	 * so that the calls per line are direct 
+	 * unless \p Source is InStreamInterface. 
+	 */
+        template<class Source, class Handler>
+        DecEncResult tryDecodeWith(Source &iStream, Handler &handler,
+				   std::string_view fileName = std::string_view())
         {
-           decode(is);
+	    StatRecorder recorder(deResult);
+	    tryDecodeWith(iStream, handler, fileName, recorder);
+	    recorder.finish();
+	    return deResult;
 	}
 
-      // TBD: the above constructor shall be replaced by the ones below
-      // to get the right exceptions. 
-        IniFile(std::ifstream &is,
-		std::vector<unsigned int> lenSections,
-		const char fieldSep,
-		const char comment)
-	  : IniFile(lenSections, fieldSep, comment)
+        template<class Source, class Handler>
+        DecEncResult tryDecodeWith(Source &iStream, Handler &handler,
+				   std::string_view fileName,
+				   StatRecorder &recorder)
         {
-           decode(is);
+	    static_assert(t_IsLineSource<Source>::value,
+			  "source shall provide isOpen, getLine, bad and close");
+	    deResult.reset();
+	    if (!iStream.isOpen())
+	        return deResult.set(STREAM_OPENR_FAILED);
+	    deResult.incLineNo();
+	    handler.start();
+	    bool inSection = false;
+	    std::vector<FileStamp> includeStack;
+	    if (!includeDirective_.empty() && !fileName.empty())
+	    {
+	        FileStamp stamp;
+	        if (stamp.read(std::string(fileName)))
+		    includeStack.push_back(stamp);
+	    }
+	    DecEncErrorCode errorCode;
+	    Token token;
+	    std::string line;
+	    for (;; deResult.incLineNo())
+            {
+	        recorder.startPhase();
+	        bool hasLine = iStream.getLine(line);
+	        recorder.stopIo();
+	        if (!hasLine)
+		    break;
+	        recorder.line(line.size());
+
+		errorCode = scanLine(line, token, recorder);
+		if (errorCode == NO_FAILURE)
+		    errorCode = dispatch(token, handler, fileName,
+					 inSection, includeStack, recorder);
+		if (errorCode != NO_FAILURE)
+		    return deResult.set(errorCode);
+	    }
+	    // TBD: treat case where the stream fails.
+
+	    // Note that the fail bit is set in conjunction with readline
+	    // in this case always, but this does not indicate a failure,
+	    // unlike the name may suggest and unlike bad bit. 
+	    if (iStream.bad())
+	      return deResult.set(STREAM_READ_FAILED);
+	    // TBD: clarify
+	    // TBD: take return value into account: maybe additional failures 
+	    iStream.close();
+
+	    // signifies success
+	    return deResult;
 	}
-      
-        IniFile(std::istringstream &is,
-		std::vector<unsigned int> lenSections,
-		const char fieldSep,
-		const char comment)
-	  : IniFile(lenSections, fieldSep, comment)
+
+    public:
+
+        DecEncResult tryDecode(InStreamInterface &iStream)
+	{
+	    MapHandler handler(*this);
+	    return tryDecodeWith(iStream, handler);
+	}
+
+        /**
+	 * Decodes \p iStream directly into the members of \p obj 
+	 * without building sections and fields in this IniFile. 
+	 * Which section and which key is written into which member 
+	 * is given by the schema <c>IniSchema<S>::get()</c>, 
+	 * by default <c>S::iniSchema()</c>. 
+	 * Members for fields not occurring in \p iStream are left unchanged. 
+	 * The separator and the comment character of this IniFile apply, 
+	 * whereas #lenSections_ is replaced by the schema. 
+	 *
+	 * @param iStream
+	 *    the stream to decode. 
+	 * @param obj
+	 *    the struct to write the converted values into. 
+	 */
+        template<class S>
+        DecEncResult tryDecode(InStreamInterface &iStream, S &obj)
+	{
+	    return tryDecodeBound(iStream, obj);
+	}
+
+    private:
+        /**
+	 * Implements #tryDecode(InStreamInterface&, S&) for any source. 
+	 */
+        template<class Source, class S>
+        DecEncResult tryDecodeBound(Source &iStream, S &obj)
+	{
+	    static constexpr auto schema = IniSchema<S>::get();
+	    typedef typename std::remove_const<decltype(schema)>::type Schema;
+	    t_BindingHandler<S, Schema> handler(schema, obj);
+	    return tryDecodeWith(iStream, handler);
+	}
+
+    public:
+
+#ifndef SSTREAM_PREVENTED
+      // TBC: with streams 
+        DecEncResult tryDecode(std::istream &iStream)
+	{
+	  t_InStream<std::istream> mystream(iStream);
+	  MapHandler handler(*this);
+	  return tryDecodeWith(mystream, handler);
+	}
+
+        template<class S>
+        DecEncResult tryDecode(std::istream &iStream, S &obj)
+	{
+	  t_InStream<std::istream> mystream(iStream);
+	  return tryDecodeBound(mystream, obj);
+	}
+#endif
+
+      // TBD: alternatives: one with and one without streams 
+	DecEncResult tryDecode(const std::string &content)
+	{
+#ifdef SSTREAM_PREVENTED
+	    InStringStreamNS iss(content);
+#else
+	    std::istringstream ss(content);
+	    InStringStream iss(ss);
+#endif
+	    MapHandler handler(*this);
+	    return tryDecodeWith(iss, handler);
+ 	}
+
+        /**
+	 * Loads the file \p fileName 
+	 * from the cache enabled by #setLoadCacheCapacity if present there, 
+	 * copying its sections and fields, 
+	 * see #tryLoadShared for access without copying. 
+	 * On failure this IniFile holds the sections and fields 
+	 * decoded before, whether the cache is enabled or not. 
+	 */
+        DecEncResult tryLoad(const std::string &fileName)
         {
-           decode(is);
+	    if (lazy_ && includeDirective_.empty())
+	        return tryLoadIndexed(fileName, NULL);
+	    if (loadCache().getCapacity() == 0)
+	        return tryLoadUncached(fileName);
+	    std::shared_ptr<const t_IniFile> doc;
+	    // failures are not cached, so decode again to keep the part before 
+	    if (!tryLoadShared(fileName, doc).isOk())
+	        return tryLoadUncached(fileName);
+	    clearLazy();
+	    map = doc->map;
+	    return deResult;
+	}
+
+        /**
+	 * Loads the file \p fileName into \p doc 
+	 * which is immutable and shared with the cache 
+	 * enabled by #setLoadCacheCapacity 
+	 * and with other callers loading the same unchanged file. 
+	 * Unlike #tryLoad(const std::string&) 
+	 * this does not copy the sections and fields, 
+	 * and unless the cache is enabled, 
+	 * it loads the file into a new IniFile 
+	 * with the grammar and the large value threshold of this one; 
+	 * a cached file loaded with others is loaded again. 
+	 * On success, the statistics are those of the decode 
+	 * unless \p doc was taken from the cache; 
+	 * on failure \p doc is NULL. 
+	 */
+        DecEncResult tryLoadShared(const std::string &fileName,
+				   std::shared_ptr<const t_IniFile> &doc)
+        {
+	    deResult.reset();
+	    doc = NULL;
+	    FileStamp stamp;
+	    if (!stamp.read(fileName))
+	        return deResult.set(STREAM_OPENR_FAILED);
+
+	    std::shared_ptr<const LoadedFile> file = loadCache().get(stamp,
+	        [this](const LoadedFile &file)
+		{
+		    const t_IniFile &cached = *file.doc;
+		    if (cached.lenSections_ != lenSections_
+			|| cached.fieldSep_ != fieldSep_
+			|| cached.comment_ != comment_
+			|| cached.includeDirective_ != includeDirective_
+			|| cached.largeValueThreshold_ != largeValueThreshold_)
+		        return false;
+		    FileStamp current;
+		    for (const std::pair<std::string, FileStamp> &included
+			     : file.includedFiles)
+		    {
+		        if (!current.read(included.first)
+			    || !(current == included.second))
+			    return false;
+		    }
+		    return true;
+		},
+		[&](std::size_t &size)
+		{
+		    std::shared_ptr<LoadedFile> loaded =
+		        std::make_shared<LoadedFile>();
+		    std::shared_ptr<t_IniFile> loadedDoc =
+		        std::make_shared<t_IniFile>(lenSections_, fieldSep_, comment_);
+		    loadedDoc->includeDirective_ = includeDirective_;
+		    loadedDoc->largeValueThreshold_ = largeValueThreshold_;
+		    loadedDoc->includedFiles_ = &loaded->includedFiles;
+		    deResult = loadedDoc->tryLoadUncached(fileName);
+		    loadedDoc->includedFiles_ = NULL;
+		    if (!deResult.isOk())
+		        return std::shared_ptr<const LoadedFile>();
+		    loaded->doc = loadedDoc;
+		    size = stamp.size;
+		    for (const std::pair<std::string, FileStamp> &included
+			     : loaded->includedFiles)
+		        size += included.second.size;
+		    return std::shared_ptr<const LoadedFile>(loaded);
+		});
+	    if (file != NULL)
+	        doc = file->doc;
+	    return deResult;
 	}
-#endif
 
+        /**
+	 * Loads the sections of the file \p fileName accepted by \p filter 
+	 * skipping the others, 
+	 * e.g. <c>tryLoad(fileName, {"logging", "metrics"})</c>. 
+	 * The lines of skipped sections are only searched for the next section; 
+	 * neither are their fields checked nor stored. 
+	 * Only the sections are checked for uniqueness and number, 
+	 * counting also the skipped ones. 
+	 * This respects #setLazy(bool) but bypasses the cache 
+	 * enabled by #setLoadCacheCapacity. 
+	 * If an include directive is set, all lines are decoded 
+	 * and only inserting the fields of skipped sections is saved. 
+	 */
+        DecEncResult tryLoad(const std::string &fileName,
+			     const SectionFilter &filter)
+        {
+	    if (!includeDirective_.empty())
+	    {
+#ifdef SSTREAM_PREVENTED
+	        InFileStreamNS ifs(fileName);
+#else
+	        std::ifstream is(fileName.c_str());
+		InFileStream ifs(is);
 #endif
+		MapHandler handler(*this, &filter);
+		return tryDecodeWith(ifs, handler, fileName);
+	    }
+	    if (!tryLoadIndexed(fileName, &filter).isOk() || lazy_)
+	        return deResult;
+	    DecEncResult result = tryValidate();
+	    clearLazy();
+	    if (!result.isOk())
+	    {
+	        deResult.lineNumber = result.lineNumber;
+		deResult.set(result.errorCode);
+	    }
+	    return deResult;
+	}
 
+        // prevents #tryLoad(const std::string&, S&) from binding filters 
+        DecEncResult tryLoad(const std::string &fileName, SectionFilter &filter)
+        {
+	    return tryLoad(fileName, const_cast<const SectionFilter&>(filter));
+	}
 
-      
+    private:
+        /**
+	 * A file decoded by #tryLoadShared 
+	 * together with the files included and their state 
+	 * which must be unchanged for it to be reused. 
+	 */
+        class LoadedFile
+        {
+        public:
+            std::shared_ptr<const t_IniFile> doc;
+            std::vector<std::pair<std::string, FileStamp> > includedFiles;
+        }; // class LoadedFile
 
-        void setFieldSep(const char sep)
+        /**
+	 * Caches decoded files per process, see #setLoadCacheCapacity. 
+	 */
+        static t_FileCache<LoadedFile> &loadCache()
         {
-            fieldSep_ = sep;
+            static t_FileCache<LoadedFile> cache(0);
+            return cache;
         }
 
-        void setCommentChar(const char comment)
+      // TBD: one with and one without streams 
+        DecEncResult tryLoadUncached(const std::string &fileName)
         {
-            comment_ = comment;
+	    // maps the file without opening a stream first 
+	    if (largeValueThreshold_ != 0)
+	        return tryLoadMapped(fileName);
+#ifdef SSTREAM_PREVENTED
+	    InFileStreamNS ifs(fileName);
+#else
+            std::ifstream is(fileName.c_str());
+	    InFileStream ifs(is);
+#endif
+	    MapHandler handler(*this);
+	    return tryDecodeWith(ifs, handler, fileName);
         }
 
-
-             IniSection & operator[](std::string key)
+        /**
+	 * Holds the content of a file loaded 
+	 * as long as fields refer to it, see #setLargeValueThreshold. 
+	 * Where possible the file is mapped into memory read-only 
+	 * so that its pages are read on access only, 
+	 * else it is read into a buffer. 
+	 * A file mapped must not be truncated while mapped, 
+	 * so it is registered in MappedFiles. 
+	 */
+        class MappedFile
         {
-	    return map[key];
-	}
+        private:
+            const char *data_;
+            std::size_t size_;
+            bool mapped_;
+            // the file mapped as registered in MappedFiles 
+            unsigned long long dev_;
+            unsigned long long ino_;
+            std::string buffer_;
+        public:
+            MappedFile() : data_(NULL), size_(0), mapped_(false), dev_(0), ino_(0)
+            {}
+            MappedFile(const MappedFile &) = delete;
+            MappedFile &operator=(const MappedFile &) = delete;
+            ~MappedFile()
+            {
+#ifndef _WIN32
+                if (mapped_)
+                {
+                    munmap(const_cast<char*>(data_), size_);
+                    MappedFiles::instance().remove(dev_, ino_);
+                }
+#endif
+            }
 
-        // TBD: in the long run this shall be removed:
-        // this method is not used in application, but for testing. 
-        // In a validating parser, only a bool valued check is necessary. 
-        unsigned int size() const
-        {
-	    return map.size();
-        }
+            std::string_view view() const
+            {
+                return mapped_ ? std::string_view(data_, size_)
+                               : std::string_view(buffer_);
+            }
 
+            /**
+	     * Maps or reads the file \p fileName into \p file 
+	     * returning DecEncErrorCode#STREAM_OPENR_FAILED 
+	     * or DecEncErrorCode#STREAM_READ_FAILED on failure. 
+	     */
+            static DecEncErrorCode open(const std::string &fileName,
+                                        std::shared_ptr<const MappedFile> &file)
+            {
+                std::shared_ptr<MappedFile> res = std::make_shared<MappedFile>();
+#ifndef _WIN32
+                int fd = ::open(fileName.c_str(), O_RDONLY);
+                if (fd < 0)
+                    return STREAM_OPENR_FAILED;
+                struct stat st;
+                // empty files cannot be mapped 
+                if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0)
+                {
+                    void *addr = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE,
+                                      fd, 0);
+                    if (addr != MAP_FAILED)
+                    {
+                        res->data_ = static_cast<const char*>(addr);
+                        res->size_ = st.st_size;
+                        res->mapped_ = true;
+                        res->dev_ = st.st_dev;
+                        res->ino_ = st.st_ino;
+                        MappedFiles::instance().add(res->dev_, res->ino_);
+                    }
+                }
+                ::close(fd);
+                if (!res->mapped_)
+#endif
+                {
+                    DecEncErrorCode errorCode = readFile(fileName, res->buffer_);
+                    if (errorCode != NO_FAILURE)
+                        return errorCode;
+                }
+                file = res;
+                return NO_FAILURE;
+            }
+
+            /**
+	     * Returns a file holding \p content read before. 
+	     */
+            static std::shared_ptr<const MappedFile> adopt(std::string &&content)
+            {
+                std::shared_ptr<MappedFile> res = std::make_shared<MappedFile>();
+                res->buffer_ = std::move(content);
+                return res;
+            }
+        }; // class MappedFile
 
         /**
-	 * 
+	 * Scans \p line like #scanLine 
+	 * if it is a field which is neither a comment nor an include directive 
+	 * but keeps its value as a view into \p line in \p value. 
+	 * Returns whether \p line is such a field; 
+	 * else it is up to #scanLine. 
 	 */
-        class InStreamInterface
-	{
-	public:
-	  virtual bool isOpen() = 0;
-	  virtual bool getLine(std::string &line) = 0;
-	  virtual bool bad() = 0;
-	  virtual int close() = 0;
-	}; // class InStreamInterface
+        bool scanLargeField(std::string_view line, Token &token,
+                            std::string_view &value) const
+        {
+            if (Dialect::ACCEPT_CRLF
+                && !line.empty() && line[line.size() - 1] == '\r')
+                line.remove_suffix(1);
+            line = t_BlankTable<Dialect>::trim(line);
+            if (line.empty() || line[0] == commentChar() || line[0] == SEC_START)
+                return false;
+            std::size_t lenDirective = includeDirective_.length();
+            if (lenDirective != 0
+                && line.compare(0, lenDirective, includeDirective_) == 0)
+                return false;
+            std::size_t pos = line.find(fieldSepChar());
+            if (pos == std::string_view::npos)
+                return false;
+            token.kind = Token::FIELD;
+            token.name.assign(t_BlankTable<Dialect>::trim(line.substr(0, pos)));
+            value = t_BlankTable<Dialect>::trim(line.substr(pos + 1));
+            return true;
+        }
 
-#ifdef SSTREAM_PREVENTED
-      // TBD: clarify whether here also out of memory may occur
-      // TBD: clarify memory leaks 
         /**
-	 * 
+	 * Loads \p fileName like #tryDecodeWith 
+	 * but from the file mapped into memory, see MappedFile, 
+	 * keeping values longer than #largeValueThreshold_ 
+	 * as views into the file instead of copying them. 
 	 */
-        class InStringStreamNS : public InStreamInterface
+        DecEncResult tryLoadMapped(const std::string &fileName)
         {
-	private:
-	  char* str_;
-	public:
-	  InStringStreamNS(std::string str)
+	    StatRecorder recorder(deResult);
+	    deResult.reset();
+	    std::shared_ptr<const MappedFile> file;
+	    recorder.startPhase();
+	    DecEncErrorCode errorCode = MappedFile::open(fileName, file);
+	    recorder.stopIo();
+	    if (errorCode != NO_FAILURE)
 	    {
-	      int n = str.length();
-	      str_ = (char*)malloc((n + 1)*sizeof(char)); 
-	      strcpy(str_, str.c_str());
+	        recorder.finish();
+	        return deResult.set(errorCode);
 	    }
-	    bool isOpen()
+	    return decodeMapped(fileName, file, recorder);
+	}
+
+        /**
+	 * Decodes \p file mapped or read from \p fileName 
+	 * as described for #tryLoadMapped(const std::string&). 
+	 */
+        DecEncResult decodeMapped(const std::string &fileName,
+				  const std::shared_ptr<const MappedFile> &file,
+				  StatRecorder &recorder)
+        {
+	    DecEncErrorCode errorCode = NO_FAILURE;
+	    MapHandler handler(*this);
+	    handler.start();
+	    bool inSection = false;
+	    std::vector<FileStamp> includeStack;
+	    if (!includeDirective_.empty())
 	    {
-	        return true;
+	        FileStamp stamp;
+	        if (stamp.read(fileName))
+		    includeStack.push_back(stamp);
 	    }
-	    bool getLine(std::string &line)
+	    std::string_view content = file->view();
+	    Token token;
+	    std::string line;
+	    std::string_view value;
+	    std::size_t pos = 0;
+	    for (deResult.incLineNo(); pos < content.size(); deResult.incLineNo())
 	    {
-		// std::cout << "InStringStreamNS.getLine str_ \n"
-		// 	  << str_ << "'\n" << std::endl;
-	        char* loc = strchr(str_, '\n');
-	        if (loc == NULL)
-	        {
-		    // no newline found 
-		    if (*str_ == '\0')
-		        return false;
-		    std::string myline(str_);
-		    line = myline;// TBD: eliminate hack 
-		    //line(str_);
-		    str_ = strchr(str_, '\0');
-		    return true;
+	        std::string_view lineView = nextLine(content, content.size(), pos);
+		recorder.line(lineView.size());
+		if (lineView.size() > largeValueThreshold_
+		    && scanLargeField(lineView, token, value)
+		    && value.size() > largeValueThreshold_)
+		{
+		    if (!inSection)
+		        errorCode = FIELD_WITHOUT_SECTION;
+		    else
+		    {
+		        // shares ownership of the file 
+		        IniField field(std::shared_ptr<const char>(file, value.data()),
+				       value.size());
+		        recorder.field();
+			recorder.startPhase();
+			errorCode = handler.field(token.name, field);
+			recorder.stopInsert();
+		    }
 		}
-		(*loc) = '\0';
-		std::string myline(str_);
-		str_=loc+1;
-		line = myline;// TBD: eliminate hack 
-	        return true;
-	    }
-	    bool bad()
-	    {
-	        return false;
-	    }
-	    int close()
-	    {
-	        return 0;
+		else
+		{
+		    line.assign(lineView);
+		    errorCode = scanLine(line, token, recorder);
+		    if (errorCode == NO_FAILURE)
+		        errorCode = dispatch(token, handler, fileName,
+					     inSection, includeStack, recorder);
+		}
+		if (errorCode != NO_FAILURE)
+		    break;
 	    }
-	}; // class InStringStreamNS
-
+	    recorder.finish();
+	    return deResult.set(errorCode);
+	}
 
+        /**
+	 * Returns the line of \p source starting at \p pos 
+	 * without the newline and advances \p pos to the next line. 
+	 */
+        static std::string_view nextLine(std::string_view source,
+					  std::size_t end,
+					  std::size_t &pos)
+        {
+	    std::size_t begin = pos;
+	    const char *newline = static_cast<const char*>
+	        (memchr(source.data() + begin, '\n', end - begin));
+	    std::size_t eol = newline == NULL ? end : newline - source.data();
+	    pos = newline == NULL ? end : eol + 1;
+	    return std::string_view(source.data() + begin, eol - begin);
+	}
 
-     // TBD: unify InFileStreamNS and OutFileStreamNS
         /**
-	 * 
+	 * Loads \p fileName lazily, see #setLazy(bool): 
+	 * reads the file into #source_ 
+	 * and creates an empty section for each section found 
+	 * accepted by \p filter unless it is NULL, 
+	 * recording the range of its lines in #lazySections_. 
+	 * Only lines defining sections and lines before the first section 
+	 * are decoded. 
 	 */
-        class InFileStreamNS : public InStreamInterface
+        DecEncResult tryLoadIndexed(const std::string &fileName,
+				    const SectionFilter *filter)
         {
-	private:
-	    static const int LEN_LINE = 255;
-	    FILE* file_;
-	    char buff[LEN_LINE];// TBC: how to get rid of this uggly 255!!!
-	    bool badBit;
-	public:
-	    InFileStreamNS(const std::string fName) //: str_(str)
-	    {
-	        file_ = fopen(fName.c_str(), "r");
-		 // std::cout << "InFileStreamNS.open '"
-		 // 	  << fName << "'" << std::endl;
-		badBit = false;
-	    }
-	    bool isOpen()
+	    StatRecorder recorder(deResult);
+	    deResult.reset();
+	    map.clear();
+	    clearLazy();
+	    map.reserve(lenSections_.size());
+	    recorder.startPhase();
+	    DecEncErrorCode errorCode = readFile(fileName, source_);
+	    recorder.stopIo();
+	    if (errorCode != NO_FAILURE)
 	    {
-	        return file_ != NULL;
+	        recorder.finish();
+	        return deResult.set(errorCode);
 	    }
-	    bool getLine(std::string &line)
+
+	    // the names of the sections in #source_ 
+	    // to check uniqueness without a linear search of #map 
+	    std::unordered_set<std::string_view> secNames;
+	    bool inSection = false;
+	    Token token;
+	    std::string line;
+	    std::size_t pos = 0;
+	    for (deResult.incLineNo(); pos < source_.size(); deResult.incLineNo())
 	    {
-	        int numItemsRead;
-		// skip empty lines 
-		do
+	        std::size_t begin = pos;
+	        std::string_view lineView = nextLine(source_, source_.size(), pos);
+		recorder.line(lineView.size());
+		std::string_view trimmed = t_BlankTable<Dialect>::trim(lineView);
+		// fields are decoded on access 
+		if (inSection && (trimmed.empty() || trimmed[0] != SEC_START))
+		    continue;
+
+		line.assign(lineView);
+		errorCode = scanLine(line, token, recorder);
+		if (errorCode == NO_FAILURE && token.kind == Token::FIELD)
+		    errorCode = FIELD_WITHOUT_SECTION;
+		if (errorCode == NO_FAILURE && token.kind == Token::SECTION)
 		{
-	            numItemsRead = fscanf(file_, "%[\n]", buff);
-		    if (ferror(file_))
+		    recorder.section();
+		    recorder.startPhase();
+		    // as checked by MapHandler 
+		    bool accepted = false;
+		    if (!secNames.insert(trimmed.substr(1, token.name.size())).second)
+		        errorCode = SECTION_NOT_UNIQUE;
+		    else if (secNames.size() > lenSections_.size())
+		        errorCode = SECTION_UNEXPECTED;
+		    else if (filter == NULL || filter->accepts(token.name))
 		    {
-		        badBit = true;
-			return false;
+		        accepted = true;
+		        map.append(token.name);
 		    }
-		    if (numItemsRead == EOF)
-		        return false;
+		    recorder.stopInsert();
+		    if (inSection && !lazySections_.empty()
+			&& lazySections_.back().end == source_.size())
+		        lazySections_.back().end = begin;
+		    inSection = true;
+		    if (accepted)
+		        lazySections_.push_back(LazySection
+			    {pos, source_.size(), deResult.lineNumber,
+			     (unsigned int)secNames.size() - 1, false});
+		}
+		if (errorCode != NO_FAILURE)
+		    break;
+	    }
+	    numUndecoded_ = lazySections_.size();
+	    recorder.finish();
+	    return deResult.set(errorCode);
+	}
 
-		} while (numItemsRead == 1);
+        /**
+	 * Decodes the fields of the \p idxSec-th section 
+	 * if it was loaded lazily and is not yet decoded. 
+	 * The first failure is recorded in #lazyResult_. 
+	 */
+        void decodeLazy(std::size_t idxSec) const
+        {
+	    // #lazySections_ grows and shrinks by non-const methods only 
+	    if (idxSec >= lazySections_.size())
+	        return;
+#ifndef THREADS_PREVENTED
+	    std::lock_guard<std::mutex> lock(lazyMutex_.mutex);
+#endif
+	    decodeLazyLocked(idxSec);
+	}
 
-		// try to read lines closed by newline or eof (greedy)
-	        numItemsRead = fscanf(file_, "%[^\n]", buff);
-		if (ferror(file_))
+        void decodeAllLazy() const
+        {
+	    if (lazySections_.empty())
+	        return;
+#ifndef THREADS_PREVENTED
+	    std::lock_guard<std::mutex> lock(lazyMutex_.mutex);
+#endif
+	    for (std::size_t idxSec = 0;
+		 numUndecoded_ != 0 && idxSec < lazySections_.size(); idxSec++)
+	        decodeLazyLocked(idxSec);
+	}
+
+        /**
+	 * Implements #decodeLazy(std::size_t) with #lazyMutex_ locked. 
+	 */
+        void decodeLazyLocked(std::size_t idxSec) const
+        {
+	    if (lazySections_[idxSec].decoded)
+	        return;
+	    LazySection &lazySec = lazySections_[idxSec];
+	    lazySec.decoded = true;
+	    numUndecoded_--;
+
+	    IniSection &section = (map.begin() + idxSec)->second;
+	    section.map.reserve(lenSections_[lazySec.idxSec]);
+	    DecEncResult result;
+	    result.lineNumber = lazySec.lineNumber;
+	    StatRecorder recorder(result);
+	    DecEncErrorCode errorCode = NO_FAILURE;
+	    Token token;
+	    std::string line;
+	    std::size_t pos = lazySec.begin;
+	    while (pos < lazySec.end)
+	    {
+	        result.incLineNo();
+		line.assign(nextLine(source_, lazySec.end, pos));
+		recorder.line(line.size());
+		errorCode = scanLine(line, token, recorder);
+		if (errorCode != NO_FAILURE)
+		    break;
+		if (token.kind != Token::FIELD)
+		    continue;
+		// as checked by MapHandler 
+		if (section.map.contains(token.name))
+		    errorCode = FIELD_NOT_UNIQUE_IN_SECTION;
+		else if (section.map.size() >= lenSections_[lazySec.idxSec])
+		    errorCode = FIELD_UNEXPECTED_IN_SECTION;
+		else
 		{
-		    badBit = true;
-		    return false;
+		    recorder.field();
+		    section.map.emplace(token.name, std::move(token.value));
 		}
-		if (numItemsRead == EOF)
-		     return false;
-		
-		line = "";// TBD: remove hack
-		line += buff;
-		  // std::cout << "InFileStreamNS.getLine '"
-		  // 	  << line << "'" << std::endl;
-	        return true;
-	    }
-	    bool bad()
-	    {
-	        return badBit;
-	    }
-	    int close()
-	    {
-	        int res = fclose(file_);
-		file_ = NULL;
-	        return res;
+		if (errorCode != NO_FAILURE)
+		    break;
 	    }
-	}; // class InFileStreamNS
+	    recorder.finish();
+	    if (errorCode != NO_FAILURE && lazyResult_.isOk())
+	        lazyResult_ = result.set(errorCode);
+	}
 
-#else
-      // T is the kind of stream under consideration:
-        // ifstream or istringstream
         /**
-	 * 
+	 * Forgets about a lazy load, 
+	 * invoked whenever the sections are replaced. 
+	 * So also all FieldHandles get stale. 
 	 */
-        template<class T>
-	class t_InStream : public InStreamInterface
-	{
-	protected:
-	    T &iStream_;
-	public:
-	    t_InStream(T &iStream) : iStream_(iStream)
-	    {
-	    }
-	    // overwritten for InFileStream
-	    bool isOpen()
+        void clearLazy()
+        {
+	    generation_.renew();
+	    source_.clear();
+	    lazySections_.clear();
+	    numUndecoded_ = 0;
+	    lazyResult_.reset();
+	}
+
+        /**
+	 * Reads the whole file \p fileName into \p content 
+	 * returning DecEncErrorCode#STREAM_OPENR_FAILED 
+	 * or DecEncErrorCode#STREAM_READ_FAILED on failure. 
+	 */
+        static DecEncErrorCode readFile(const std::string &fileName,
+					std::string &content)
+        {
+	    FILE *file = fopen(fileName.c_str(), "rb");
+	    if (file == NULL)
+	        return STREAM_OPENR_FAILED;
+	    struct stat st;
+	    if (fstat(fileno(file), &st) == 0 && st.st_size > 0)
+	        content.reserve(st.st_size);
+	    char buff[4096];
+	    std::size_t numRead;
+	    while ((numRead = fread(buff, 1, sizeof(buff), file)) != 0)
+	        content.append(buff, numRead);
+	    bool failed = ferror(file) != 0;
+	    fclose(file);
+	    return failed ? STREAM_READ_FAILED : NO_FAILURE;
+	}
+
+#ifndef THREADS_PREVENTED
+        /**
+	 * Admits at most a given number of threads at a time, 
+	 * used by #loadAll to bound the number of files read concurrently. 
+	 */
+        class IoGate
+        {
+        private:
+            std::mutex mutex_;
+            std::condition_variable free_;
+            unsigned int numFree_;
+        public:
+            IoGate(unsigned int numFree) : numFree_(numFree)
+            {}
+            void enter()
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                free_.wait(lock, [this] { return numFree_ != 0; });
+                numFree_--;
+            }
+            void leave()
+            {
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    numFree_++;
+                }
+                free_.notify_one();
+            }
+        }; // class IoGate
+#endif
+
+        /**
+	 * Decodes \p content read from \p fileName into this IniFile 
+	 * unless reading failed with \p errorCode. 
+	 * If #largeValueThreshold_ is set, 
+	 * \p content is taken over by the large values referring to it. 
+	 */
+        DecEncResult decodeRead(const std::string &fileName,
+				DecEncErrorCode errorCode,
+				std::string &content)
+        {
+	    if (errorCode != NO_FAILURE)
 	    {
-	      return true;
+	        deResult.reset();
+	        return deResult.set(errorCode);
 	    }
-	    bool getLine(std::string &line)
+	    if (largeValueThreshold_ != 0)
 	    {
-	      return (bool)std::getline(iStream_, line, '\n');
+	        StatRecorder recorder(deResult);
+		deResult.reset();
+		return decodeMapped(fileName, MappedFile::adopt(std::move(content)),
+				    recorder);
 	    }
-	    // TBC: can this be false for an istringstream??
-	    bool bad()
+	    InStringViewStream iss(content);
+	    MapHandler handler(*this);
+	    return tryDecodeWith(iss, handler, fileName);
+	}
+
+        /**
+	 * Reads \p fileName into \p content within \p gate 
+	 * and decodes it into this IniFile outside. 
+	 */
+        template<class Gate>
+        DecEncResult loadVia(Gate &gate,
+			     const std::string &fileName,
+			     std::string &content)
+        {
+	    content.clear();
+	    // leaves the gate also if reading throws 
+	    class Pass
 	    {
-	        return iStream_.bad();
-	    }
-	   // overwritten for InFileStream
-	  // TBD: this shall be eliminated
-	  // just to avoid tryDecode on general streams
-	  // which may not be appropriate 
-	    int close()
+	    private:
+	        Gate &gate_;
+	    public:
+	        Pass(Gate &gate) : gate_(gate)
+	        {
+		    gate_.enter();
+		}
+	        ~Pass()
+	        {
+		    gate_.leave();
+		}
+	    };
+	    DecEncErrorCode errorCode;
 	    {
-	      //iStream_.close();
-	        return 0;
+	        Pass pass(gate);
+		errorCode = readFile(fileName, content);
 	    }
-	};  // class t_InStream
+	    return decodeRead(fileName, errorCode, content);
+	}
 
         /**
-	 * 
+	 * Returns the result of \p func() 
+	 * or one with DecEncErrorCode#EXCEPTION_CAUGHT if it throws, 
+	 * so that no exception escapes a thread of #loadAll. 
 	 */
-        class InStringStream : public t_InStream<std::istringstream>
+        template<class F>
+        static DecEncResult catchAll(F func)
         {
-	public:
-	
-	    InStringStream(std::istringstream &iStream) : t_InStream(iStream)
+#ifdef __cpp_exceptions
+	    try
 	    {
+	        return func();
 	    }
-	    // }
-	    // bool isOpen()
-	    // {
-	    //   return true;
-	    // }
+	    catch (...)
+	    {
+	        DecEncResult result;
+		return result.set(EXCEPTION_CAUGHT);
+	    }
+#else
+	    return func();
+#endif
+	}
 
-	  // TBD: this shall be activated instead of template 
-	    // int close()
-	    // {
-	    //   //iStream_.close();
-	    //     return 0;
-	    // }
-	};  // class InStringStream
+        /**
+	 * Sets DecEncErrorCode#INI_FILE_MISSING in \p results 
+	 * for the file names without IniFile 
+	 * and returns the number of files to load or save. 
+	 */
+        static std::size_t checkSizes(const std::vector<t_IniFile> &iniFiles,
+				      std::vector<DecEncResult> &results)
+        {
+	    std::size_t numFiles = std::min(iniFiles.size(), results.size());
+	    for (std::size_t idx = numFiles; idx < results.size(); idx++)
+	        results[idx].set(INI_FILE_MISSING);
+	    return numFiles;
+	}
 
-              /**
-	 * 
+        /**
+	 * Invokes \p func(idx, buffer) for each idx below \p num 
+	 * on \p numThreads threads including the calling one, 
+	 * where buffer is a string reused within each thread. 
+	 * If THREADS_PREVENTED is set, all runs in the calling thread. 
 	 */
-      class InFileStream : public t_InStream<std::ifstream>
-      {
-	public:
-	    InFileStream(std::ifstream &iStream) : t_InStream(iStream)
-	    {
-	    }
-	    bool isOpen()
+        template<class F>
+        static void forEachConcurrently(std::size_t num,
+					unsigned int numThreads,
+					F func)
+        {
+#ifdef THREADS_PREVENTED
+	    (void)numThreads;
+	    std::string buffer;
+	    for (std::size_t idx = 0; idx < num; idx++)
+	        func(idx, buffer);
+#else
+	    std::atomic<std::size_t> next(0);
+	    auto work = [&]()
 	    {
-	      return iStream_.is_open();
-	    }
-	    int close()
+	        std::string buffer;
+	        for (std::size_t idx = next++; idx < num; idx = next++)
+		    func(idx, buffer);
+	    };
+	    std::vector<std::thread> threads;
+	    for (unsigned int idx = 1; idx < numThreads; idx++)
 	    {
-	        iStream_.close();
-		return 0;
+#ifdef __cpp_exceptions
+	        // if threads cannot be created, fewer do the work 
+	        try
+		{
+		    threads.emplace_back(work);
+		}
+		catch (...)
+		{
+		    break;
+		}
+#else
+	        threads.emplace_back(work);
+#endif
 	    }
-	};  // class InFileStream
+	    // the calling thread works as well 
+	    work();
+	    for (std::thread &thread : threads)
+	        thread.join();
+#endif
+	}
 
+    public:
+        /**
+	 * Loads the file \p fileNames[i] into \p iniFiles[i] for each i 
+	 * concurrently on \p numThreads threads 
+	 * and returns the results in the order of \p fileNames. 
+	 * Each file is decoded with the grammar, the include directive 
+	 * and the large value threshold of its IniFile, 
+	 * see #setLargeValueThreshold, 
+	 * but unlike #tryLoad(const std::string&) 
+	 * neither lazily, see #setLazy(bool), 
+	 * nor via the cache enabled by #setLoadCacheCapacity. 
+	 * Each file is read at once before it is decoded 
+	 * and at most \p numConcurrentReads files are read at a time 
+	 * so that disks are not thrashed; 
+	 * decoding is not limited that way. 
+	 * If IO_URING_ENABLED is set and the kernel provides io_uring, 
+	 * instead \p numConcurrentReads files at a time are read 
+	 * with a few system calls, see IoUring, 
+	 * and decoded concurrently before the next ones are read. 
+	 * If THREADS_PREVENTED is set, files are loaded one after another. 
+	 *
+	 * @param iniFiles
+	 *    as many IniFiles as \p fileNames, 
+	 *    specifying the sections and the grammar of each file. 
+	 *    File names without IniFile are not loaded 
+	 *    but fail with DecEncErrorCode#INI_FILE_MISSING. 
+	 *    Exceptions loading a file, e.g. std::bad_alloc, 
+	 *    are caught and fail with DecEncErrorCode#EXCEPTION_CAUGHT. 
+	 * @param fileNames
+	 *    the names of the files to load. 
+	 * @param numThreads
+	 *    the number of threads to decode with; 
+	 *    if 0, as many as the hardware supports. 
+	 * @param numConcurrentReads
+	 *    the maximal number of files read at a time; 
+	 *    if 0, the number of threads. 
+	 */
+        static std::vector<DecEncResult>
+	loadAll(std::vector<t_IniFile> &iniFiles,
+		const std::vector<std::string> &fileNames,
+		unsigned int numThreads = 0,
+		unsigned int numConcurrentReads = 0)
+        {
+	    std::vector<DecEncResult> results(fileNames.size());
+	    std::size_t numFiles = checkSizes(iniFiles, results);
+#ifndef THREADS_PREVENTED
+	    if (numThreads == 0)
+	        numThreads = std::max(1u, std::thread::hardware_concurrency());
+	    if (numThreads > numFiles)
+	        numThreads = std::max<std::size_t>(1, numFiles);
+	    if (numConcurrentReads == 0)
+	        numConcurrentReads = numThreads;
 #endif
 
+	    // the files loaded via io_uring 
+	    std::size_t numLoaded = 0;
+#ifdef IO_URING_ENABLED
+	    IoUring ring;
+	    if (ring.isOpen())
+	    {
+	        std::size_t numPerRound = std::max(1u, numConcurrentReads);
+	        std::vector<std::string> names;
+		std::vector<std::string> contents;
+		std::vector<DecEncErrorCode> errorCodes;
+		std::vector<std::size_t> reread;
+		for (; numLoaded < numFiles; numLoaded += names.size())
+		{
+		    std::size_t start = numLoaded;
+		    names.assign(fileNames.begin() + start,
+				 fileNames.begin()
+				 + std::min(numFiles, start + numPerRound));
+		    reread.clear();
+		    // else the remaining files are loaded by streams 
+		    if (!ring.readFiles(names, contents, errorCodes, reread))
+		        break;
+		    // changed while reading 
+		    for (std::size_t idx : reread)
+		    {
+		        contents[idx].clear();
+			errorCodes[idx] = readFile(names[idx], contents[idx]);
+		    }
+		    forEachConcurrently(names.size(), numThreads,
+					[&](std::size_t idx, std::string&)
+		        {
+			    results[start + idx] = catchAll([&]()
+			        {
+				    return iniFiles[start + idx]
+				        .decodeRead(names[idx], errorCodes[idx],
+						    contents[idx]);
+				});
+			    // no longer needed 
+			    std::string().swap(contents[idx]);
+			});
+		}
+	    }
+#endif
 
+#ifdef THREADS_PREVENTED
+	    (void)numConcurrentReads;
+	    class NoGate
+	    {
+	    public:
+	        void enter() {}
+	        void leave() {}
+	    } gate;
+#else
+	    IoGate gate(numConcurrentReads);
+#endif
+	    forEachConcurrently(numFiles - numLoaded, numThreads,
+				[&](std::size_t idx, std::string &buffer)
+	        {
+		    idx += numLoaded;
+		    results[idx] = catchAll([&]()
+		        {
+			    return iniFiles[idx].loadVia(gate, fileNames[idx],
+							 buffer);
+			});
+		});
+	    return results;
+	}
 
-        DecEncResult tryDecode(InStreamInterface &iStream)
-	{
-	    deResult.reset();
-	    if (!iStream.isOpen())
-	        return deResult.set(STREAM_OPENR_FAILED);
-	    deResult.incLineNo();
-	    map.clear();
-	    unsigned int idxSec = -1;
-	    // superfluous, only to cause error if used uninitilized
-	    // (also to avoid compiler warnings)
-	    unsigned int idxFieldInSec = -1;
-	    IniSection *currentSection = NULL;
-	    for (std::string line; iStream.getLine(line); deResult.incLineNo())
-            {
-                trim(line);
-		//std::cout << "decoding line " << line << std::endl;
-		
-                // skip if line is empty or a comment
-                if (line.size() == 0 || line[0] == comment_)
-                    continue;
-		
-                if (line[0] == SEC_START)
-                {
-                    // line defines a section
-                    // check if the section is also closed on same line
-                    std::size_t pos = line.find(SEC_END);
-                    if(pos == std::string::npos)
-		        return deResult.set(SECTION_NOT_CLOSED);
-                    // check if the section name is empty
-                    if(pos == 1)
-			return deResult.set(SECTION_NAME_EMPTY);
-                    // check if there is text
-		    // between closing bracket and newline 
-                    if(pos + 1 != line.length())
-			return deResult.set(SECTION_TEXT_AFTER);
-                    // retrieve section name
-                    std::string secName = line.substr(1, pos - 1);
-		    // std::cout << "section name '"
-		    // 	      << secName << "'" << std::endl;
-		    // check if section name occurred before 
-		    if (this->map.contains(secName))
-		        return deResult.set(SECTION_NOT_UNIQUE);
-		    
-		    idxSec++;
-		    if (idxSec >= lenSections_.size())
+        /**
+	 * Saves \p iniFiles[i] into the file \p fileNames[i] for each i 
+	 * like #trySave(const std::string&) 
+	 * and returns the results in the order of \p fileNames. 
+	 * If IO_URING_ENABLED is set and the kernel provides io_uring, 
+	 * all files are encoded first and then written in batches 
+	 * with a few system calls per batch, see IoUring; 
+	 * else one after another. 
+	 *
+	 * @param iniFiles
+	 *    as many IniFiles as \p fileNames; 
+	 *    file names without IniFile are not written 
+	 *    but fail with DecEncErrorCode#INI_FILE_MISSING. 
+	 *    Exceptions saving a file, e.g. std::bad_alloc, 
+	 *    are caught and fail with DecEncErrorCode#EXCEPTION_CAUGHT. 
+	 * @param fileNames
+	 *    the names of the files to save to. 
+	 */
+        static std::vector<DecEncResult>
+	saveAll(std::vector<t_IniFile> &iniFiles,
+		const std::vector<std::string> &fileNames)
+        {
+	    std::vector<DecEncResult> results(fileNames.size());
+	    std::size_t numFiles = checkSizes(iniFiles, results);
+#ifdef IO_URING_ENABLED
+	    IoUring ring;
+	    if (ring.isOpen())
+	    {
+	        std::vector<std::size_t> indices;
+	        std::vector<std::string> names;
+	        std::vector<std::string> contents;
+		for (std::size_t idx = 0; idx < numFiles; idx++)
+		{
+		    // io_uring would overwrite in place 
+		    if (MappedFiles::instance().contains(fileNames[idx]))
 		    {
-		        return deResult.set(SECTION_UNEXPECTED);
+		        results[idx] = catchAll([&]()
+			    {
+			        return iniFiles[idx].trySave(fileNames[idx]);
+			    });
+			continue;
 		    }
-		    idxFieldInSec = 0;
-                    currentSection = &(this->map[secName]);
-		    //std::cout << " found section " << currentSection << std::endl;
+		    std::string content;
+		    results[idx] = catchAll([&]()
+		        {
+			    return iniFiles[idx].tryEncode(content);
+			});
+		    // files not encoded are not written 
+		    if (!results[idx].isOk())
+		        continue;
+		    indices.push_back(idx);
+		    names.push_back(fileNames[idx]);
+		    contents.push_back(std::move(content));
 		}
-                else
+		std::vector<DecEncErrorCode> errorCodes;
+		if (ring.writeFiles(names, contents, errorCodes))
 		{
-                    // find key value separator
-                    std::size_t pos = line.find(fieldSep_);
-                    if(pos == std::string::npos)
-		        return deResult.set(ILLEGAL_LINE);
-                    // line is a field definition
-		    //std::cout << " iskey-value " << std::endl;
-                    // check if section was already opened
-                    if(currentSection == NULL)
-		        return deResult.set(FIELD_WITHOUT_SECTION);
-
-                    // retrieve field key and value
-                    std::string key = line.substr(0, pos);
-                    trim(key);
-                    std::string value = line.substr(pos + 1, std::string::npos);
-                    trim(value);
-
-		    // check if key name is  occurred before within the section
-		    if (currentSection->map.contains(key))
-		        return deResult.set(FIELD_NOT_UNIQUE_IN_SECTION);
-
-		    
-		    if (idxFieldInSec >= lenSections_[idxSec])
+		    for (std::size_t pos = 0; pos < indices.size(); pos++)
 		    {
- 		      return deResult.set(FIELD_UNEXPECTED_IN_SECTION);
+		        if (errorCodes[pos] == NO_FAILURE)
+			    continue;
+			std::size_t idx = indices[pos];
+			iniFiles[idx].deResult.reset();
+			results[idx] = iniFiles[idx].deResult.set(errorCodes[pos]);
 		    }
-		    idxFieldInSec++;
-
-		    
-                    (currentSection->map)[key] = value;
+		    return results;
 		}
+		// else write again by streams 
 	    }
-	    // TBD: treat case where the stream fails.
-
-	    // Note that the fail bit is set in conjunction with readline
-	    // in this case always, but this does not indicate a failure,
-	    // unlike the name may suggest and unlike bad bit. 
-	    if (iStream.bad())
-	      return deResult.set(STREAM_READ_FAILED);
-	    // TBD: clarify
-	    // TBD: take return value into account: maybe additional failures 
-	    iStream.close();
-
-	    // signifies success
-	    //deResult.reset();// for line number only, well... 
-	    return deResult;
-	}
-
-#ifndef SSTREAM_PREVENTED
-      // TBC: with streams 
-        DecEncResult tryDecode(std::istream &iStream)
-	{
-	  t_InStream<std::istream> mystream(iStream);
-	  return tryDecode(mystream);
-	}
 #endif
+	    for (std::size_t idx = 0; idx < numFiles; idx++)
+	        results[idx] = catchAll([&]()
+		    {
+		        return iniFiles[idx].trySave(fileNames[idx]);
+		    });
+	    return results;
+	}
 
-      // TBD: alternatives: one with and one without streams 
-	DecEncResult tryDecode(const std::string &content)
+        template<class S>
+	DecEncResult tryDecode(const std::string &content, S &obj)
 	{
 #ifdef SSTREAM_PREVENTED
 	    InStringStreamNS iss(content);
@@ -1169,11 +7168,11 @@ namespace ini
 	    std::istringstream ss(content);
 	    InStringStream iss(ss);
 #endif
-            return tryDecode(iss);
+            return tryDecodeBound(iss, obj);
  	}
 
-      // TBD: one with and one without streams 
-        DecEncResult tryLoad(const std::string &fileName)
+        template<class S>
+        DecEncResult tryLoad(const std::string &fileName, S &obj)
         {
 #ifdef SSTREAM_PREVENTED
 	    InFileStreamNS ifs(fileName);
@@ -1181,7 +7180,10 @@ namespace ini
             std::ifstream is(fileName.c_str());
 	    InFileStream ifs(is);
 #endif
-            return tryDecode(ifs);
+	    static constexpr auto schema = IniSchema<S>::get();
+	    typedef typename std::remove_const<decltype(schema)>::type Schema;
+	    t_BindingHandler<S, Schema> handler(schema, obj);
+	    return tryDecodeWith(ifs, handler, fileName);
         }
 
         /**
@@ -1191,7 +7193,7 @@ namespace ini
 	{
 	public:
 	    virtual bool isOpen() = 0;
-	    virtual OutStreamInterface& append(std::string str) = 0;
+	    virtual OutStreamInterface& append(const std::string &str) = 0;
 	    virtual OutStreamInterface& append(char ch) = 0;
 	    virtual OutStreamInterface& appendNl() = 0;
 	    virtual std::string& str() = 0;
@@ -1199,6 +7201,53 @@ namespace ini
 	    virtual int close() = 0;
 	}; // class OutStreamInterface
 
+        /**
+	 * Appends to a string given, both with and without streams. 
+	 * If the capacity reserved by the constructor suffices, 
+	 * appending does not allocate. 
+	 */
+        class OutStringBuffer : public OutStreamInterface
+	{
+	private:
+	    std::string &str_;
+	public:
+	    OutStringBuffer(std::string &str, std::size_t capacity) : str_(str)
+	    {
+	        str_.reserve(str_.length() + capacity);
+	    }
+	    bool isOpen()
+	    {
+	        return true;
+	    }
+	    OutStreamInterface& append(const std::string &str)
+	    {
+	        str_ += str;
+		return *this;
+	    }
+	    OutStreamInterface& append(char ch)
+	    {
+	        str_ += ch;
+		return *this;
+	    }
+	    OutStreamInterface& appendNl()
+	    {
+	        str_ += '\n';
+		return *this;
+	    }
+	    std::string& str()
+	    {
+	        return str_;
+	    }
+	    bool bad()
+	    {
+	        return false;
+	    }
+	    int close()
+	    {
+	        return 0;
+	    }
+	}; // class OutStringBuffer
+
 #ifdef SSTREAM_PREVENTED
       // TBD: check memory leaks 
         /**
@@ -1219,7 +7268,7 @@ namespace ini
 	    {
 	        return true;
 	    }
-	    OutStreamInterface& append(std::string str)
+	    OutStreamInterface& append(const std::string &str)
 	    {
 	        strcpy(ptr_, str.c_str());
 		ptr_ += str.length();
@@ -1278,7 +7327,7 @@ namespace ini
 	    {
 	        return file_ != NULL;
 	    }
-	    OutStreamInterface& append(std::string str)
+	    OutStreamInterface& append(const std::string &str)
 	    {
 	        int numCharsWritten = fprintf(file_, "%s", str.c_str());
 		// TBD: more research 
@@ -1357,7 +7406,7 @@ namespace ini
 	    {
 	      return true;
 	    }
-	    OutStreamInterface& append(std::string str)
+	    OutStreamInterface& append(const std::string &str)
 	    {
 	        oStream_ << str;
 	        return *this;
@@ -1399,7 +7448,8 @@ namespace ini
         class OutStringStream : public t_OutStream<std::ostringstream>
       	{
       	public:
-      	    OutStringStream(std::ostringstream &oStream) : t_OutStream(oStream)
+      	    OutStringStream(std::ostringstream &oStream)
+      	      : t_OutStream<std::ostringstream>(oStream)
       	    {
       	    }
       	    // overwritten for OutFileStream
@@ -1410,7 +7460,7 @@ namespace ini
 	    std::string& str()
 	    {
 	      //std::string res = "invalid; dont ask me";
-	         std::string res = oStream_.str();
+	         std::string res = this->oStream_.str();
 		 return *new std::string(res);
 	        //return *new std::string("invalid; dont ask me");
 	    }
@@ -1426,13 +7476,14 @@ namespace ini
         class OutFileStream : public t_OutStream<std::ofstream>
      	{
      	public:
-     	    OutFileStream(std::ofstream &oStream) : t_OutStream(oStream)
+     	    OutFileStream(std::ofstream &oStream)
+     	      : t_OutStream<std::ofstream>(oStream)
      	    {
      	    }
      	    // overwritten for OutFileStream
      	    bool isOpen()
      	    {
-     	      return oStream_.is_open();
+     	      return this->oStream_.is_open();
      	    }
 	  // TBD: eliminate: bad design 
 	    std::string& str()
@@ -1441,7 +7492,7 @@ namespace ini
 	    }
      	    int close()
      	    {
-     	        oStream_.close();
+     	        this->oStream_.close();
 	        return 0;
      	    }
         }; // class OutFileStream
@@ -1452,29 +7503,49 @@ namespace ini
       
      
         DecEncResult tryEncode(OutStreamInterface &oStream)
+        {
+	    StatRecorder recorder(deResult);
+	    tryEncode(oStream, recorder);
+	    recorder.finish();
+	    return deResult;
+	}
+
+    private:
+        DecEncResult tryEncode(OutStreamInterface &oStream,
+			       StatRecorder &recorder)
         {
 	    deResult.reset();
 	    if (!oStream.isOpen())
 	        return deResult.set(STREAM_OPENW_FAILED);
+	    decodeAllLazy();
 	    deResult.incLineNo();
             // iterate through all sections in this file
             //for (auto &filePair : *this)
-            for (decltype(this->map)::iterator filePair=this->map.begin();
+            for (typename decltype(this->map)::iterator filePair=this->map.begin();
 		 filePair!=this->map.end();
 		 filePair++)
             {
+	        recorder.section();
+	        recorder.line(filePair->first.length() + 2);
+	        recorder.startPhase();
 	        oStream.append(SEC_START)
 		  .append(filePair->first).append(SEC_END)
 		  .appendNl();
+	        recorder.stopIo();
 		deResult.incLineNo();
                 // iterate through all fields in the section
                 //for (auto &secPair : filePair->second)
-                for (decltype(filePair->second.map)::iterator secPair=filePair->second.map.begin();
+                for (typename decltype(filePair->second.map)::iterator secPair=filePair->second.map.begin();
 		      secPair!=filePair->second.map.end();
 		      secPair++)
 		{
-		    oStream.append(secPair->first            ).append(fieldSep_)
-		      .     append(secPair->second.toString()).appendNl();
+		    const std::string &value = secPair->second.toString();
+		    recorder.field();
+		    recorder.line(secPair->first.length() + 1 + value.length());
+		    recorder.startPhase();
+		    oStream.append(secPair->first).append(fieldSepChar())
+		      .     append(value         ).appendNl();
+		    recorder.stopIo();
 		    deResult.incLineNo();
 		}
             }
@@ -1489,14 +7560,19 @@ namespace ini
 	    return deResult;
         }
 
+    public:
+
 
 
-#ifdef SSTREAM_PREVENTED
-      // TBD: used only if SSTREAM_PREVENTED
-        unsigned int lengthText()
+        /**
+	 * Returns the length of the text #tryEncode(OutStreamInterface&) 
+	 * writes. 
+	 */
+        unsigned int lengthText() const
         {
+	    decodeAllLazy();
 	    unsigned int res = 0;
-	    for (auto &pair : map)
+	    for (const auto &pair : map)
 	    {
 	        // for each section length of name of section
 	        // plus 2 for enclosing [...] plus 1 for newline 
@@ -1506,7 +7582,8 @@ namespace ini
 	    }
 	    return res;
 	}
- #else
+
+#ifndef SSTREAM_PREVENTED
     // TBC: with streams 
         DecEncResult tryEncode(std::ostream &oStream)
 	{
@@ -1515,23 +7592,38 @@ namespace ini
 	}
 #endif
       
-      // TBD: alternatives: one with and one without streams 
+        /**
+	 * Encodes into \p content replacing its former text. 
+	 * Its capacity is reserved for the whole text in advance, 
+	 * so this allocates at most once. 
+	 */
 	DecEncResult tryEncode(std::string &content)
 	{
-#ifdef SSTREAM_PREVENTED
-	    OutStringStreamNS oss(this->lengthText());
-#else
-	    std::ostringstream ss;
-	    OutStringStream oss(ss);
-#endif
-            DecEncResult res = tryEncode(oss);
-	    content = oss.str();
-	    return res;
+	    content.clear();
+	    OutStringBuffer osb(content, this->lengthText());
+            return tryEncode(osb);
  	}
 
        // TBD: alternatives: one with and one without streams 
+        /**
+	 * Saves into the file \p fileName. 
+	 * If it is mapped for values referred to, 
+	 * see #setLargeValueThreshold(std::size_t), 
+	 * it is replaced by a new file instead of being overwritten, 
+	 * so that the values in the former file stay valid. 
+	 */
        DecEncResult trySave(const std::string &fileName)
         {
+#ifndef _WIN32
+	    if (MappedFiles::instance().contains(fileName))
+	        return trySaveReplacing(fileName);
+#endif
+	    return trySaveInPlace(fileName);
+        }
+
+    private:
+        DecEncResult trySaveInPlace(const std::string &fileName)
+        {
 #ifdef SSTREAM_PREVENTED
 	    OutFileStreamNS ofs(fileName);
 #else
@@ -1541,6 +7633,36 @@ namespace ini
             return tryEncode(ofs);
         }
 
+#ifndef _WIN32
+        /**
+	 * Saves into a new file next to \p fileName 
+	 * with the same permissions, 
+	 * which is then renamed to \p fileName replacing the former one. 
+	 */
+        DecEncResult trySaveReplacing(const std::string &fileName)
+        {
+	    std::string tmpName = fileName + ".XXXXXX";
+	    int fd = mkstemp(&tmpName[0]);
+	    if (fd < 0)
+	    {
+	        deResult.reset();
+		return deResult.set(STREAM_OPENW_FAILED);
+	    }
+	    struct stat st;
+	    if (stat(fileName.c_str(), &st) == 0)
+	        fchmod(fd, st.st_mode & 07777);
+	    ::close(fd);
+	    trySaveInPlace(tmpName);
+	    if (deResult.isOk() && ::rename(tmpName.c_str(), fileName.c_str()) != 0)
+	        deResult.set(STREAM_WRITE_FAILED);
+	    if (!deResult.isOk())
+	        ::remove(tmpName.c_str());
+	    return deResult;
+	}
+#endif
+
+    public:
+
 
 #ifndef THROW_PREVENTED
     private:
@@ -1548,6 +7670,9 @@ namespace ini
       	    // TBD: close stream?
 	    void throwIfError(DecEncResult dRes)
 	    {
+	        // the message is built only on failure 
+	        if (dRes.isOk())
+		    return;
 		std::string str = "";
 	        if (dRes.lineNumber == 0)
 		{
@@ -1592,6 +7717,21 @@ namespace ini
 		case FIELD_UNEXPECTED_IN_SECTION:
 		    str += "unexpected field in section";
 		    break;
+		case FIELD_CONVERSION_FAILED:
+		    str += "field value not convertible to type of bound member";
+		    break;
+		case FIELD_NOT_FOUND:
+		    str += "field not found";
+		    break;
+		case INCLUDE_CYCLIC:
+		    str += "cyclic include";
+		    break;
+		case INI_FILE_MISSING:
+		    str += "no ini file for the file name";
+		    break;
+		case EXCEPTION_CAUGHT:
+		    str += "exception";
+		    break;
 		case STREAM_OPENR_FAILED:
 		  // TBD: specified whether failbit or badbit is set. 
 		    str += "could not open stream for read";
@@ -1634,6 +7774,36 @@ namespace ini
 	    throwIfError(tryLoad(fileName));
         }
 
+        template<class S>
+        void decode(const std::string &content, S &obj)
+        {
+	    throwIfError(tryDecode(content, obj));
+        }
+
+        template<class S>
+        void load(const std::string &fileName, S &obj)
+        {
+	    throwIfError(tryLoad(fileName, obj));
+        }
+
+        void load(const std::string &fileName, const SectionFilter &filter)
+        {
+	    throwIfError(tryLoad(fileName, filter));
+        }
+
+        void load(const std::string &fileName, SectionFilter &filter)
+        {
+	    throwIfError(tryLoad(fileName, filter));
+        }
+
+        /**
+	 * Like #tryValidate() but throws on failure. 
+	 */
+        void validate()
+        {
+	    throwIfError(tryValidate());
+        }
+
               std::string encode()
         {
 	  //std::ostringstream ss;
@@ -1710,6 +7880,183 @@ namespace ini
 
 #endif
     };
+
+    typedef t_IniFile<RuntimeDialect> IniFile;
+
+    /**
+     * Writes an ini-file section by section and field by field 
+     * as given by the caller, 
+     * e.g. from a database cursor, 
+     * without building an IniFile. 
+     * Lines are collected in a buffer of fixed size 
+     * which is appended to the underlying stream when full 
+     * and by #finish(). 
+     * So memory is constant unless uniqueness is checked, 
+     * which requires the names of all sections 
+     * and the keys of the current section. 
+     * The text is the same as written by 
+     * IniFile#tryEncode(OutStreamInterface&) 
+     * for an IniFile with the same sections and fields. 
+     */
+    class IniWriter
+    {
+    public:
+        /**
+	 * The size of the buffer in bytes. 
+	 */
+        static const std::size_t BUFFER_SIZE = 64*1024;
+
+    private:
+        IniFile::OutStreamInterface &oStream_;
+        const char fieldSep_;
+        const bool checkUnique_;
+        std::string buffer_;
+        // used to convert values like IniField#operator= 
+        IniField converter_;
+        bool inSection_;
+        std::unordered_set<std::string> secNames_;
+        std::unordered_set<std::string> keys_;
+
+        void flushIfFull()
+        {
+            if (buffer_.size() < BUFFER_SIZE)
+                return;
+            oStream_.append(buffer_);
+            buffer_.clear();
+        }
+
+    public:
+        /**
+	 * @param oStream
+	 *    the stream to write to. 
+	 * @param fieldSep
+	 *    the separator between key and value. 
+	 * @param checkUnique
+	 *    whether #beginSection(std::string_view) 
+	 *    and #field(std::string_view, std::string_view) 
+	 *    reject sections and keys within a section written before. 
+	 *    By default false, relying on the caller. 
+	 */
+        IniWriter(IniFile::OutStreamInterface &oStream,
+                  char fieldSep = '=',
+                  bool checkUnique = false)
+          : oStream_(oStream),
+            fieldSep_(fieldSep),
+            checkUnique_(checkUnique),
+            inSection_(false)
+        {
+            buffer_.reserve(BUFFER_SIZE + 256);
+        }
+
+        /**
+	 * Starts the section \p secName. 
+	 *
+	 * @return
+	 *    DecEncErrorCode#SECTION_NAME_EMPTY, 
+	 *    DecEncErrorCode#SECTION_NOT_UNIQUE if checked, 
+	 *    DecEncErrorCode#STREAM_OPENW_FAILED 
+	 *    or else DecEncErrorCode#NO_FAILURE. 
+	 */
+        DecEncErrorCode beginSection(std::string_view secName)
+        {
+            if (!oStream_.isOpen())
+                return STREAM_OPENW_FAILED;
+            if (secName.empty())
+                return SECTION_NAME_EMPTY;
+            if (checkUnique_)
+            {
+                if (!secNames_.emplace(secName).second)
+                    return SECTION_NOT_UNIQUE;
+                keys_.clear();
+            }
+            inSection_ = true;
+            buffer_ += '[';
+            buffer_ += secName;
+            buffer_ += ']';
+            buffer_ += '\n';
+            flushIfFull();
+            return NO_FAILURE;
+        }
+
+        /**
+	 * Writes the field \p key with value \p value 
+	 * into the current section. 
+	 *
+	 * @return
+	 *    DecEncErrorCode#FIELD_WITHOUT_SECTION, 
+	 *    DecEncErrorCode#FIELD_NOT_UNIQUE_IN_SECTION if checked, 
+	 *    or else DecEncErrorCode#NO_FAILURE. 
+	 */
+        DecEncErrorCode field(std::string_view key, std::string_view value)
+        {
+            if (!inSection_)
+                return FIELD_WITHOUT_SECTION;
+            if (checkUnique_ && !keys_.emplace(key).second)
+                return FIELD_NOT_UNIQUE_IN_SECTION;
+            buffer_ += key;
+            buffer_ += fieldSep_;
+            buffer_ += value;
+            buffer_ += '\n';
+            flushIfFull();
+            return NO_FAILURE;
+        }
+
+        /**
+	 * Writes the field \p key with value \p value 
+	 * converted like by assigning it to an IniField, 
+	 * e.g. a number or a bool. 
+	 */
+        template<typename T>
+        DecEncErrorCode field(std::string_view key, const T &value)
+        {
+            if constexpr (std::is_convertible<const T&, std::string_view>::value)
+            {
+                return field(key, std::string_view(value));
+            }
+            else
+            {
+                converter_ = value;
+                return field(key, std::string_view(converter_.toString()));
+            }
+        }
+
+        /**
+	 * Appends what is left in the buffer to the stream and closes it. 
+	 *
+	 * @return
+	 *    DecEncErrorCode#STREAM_WRITE_FAILED if writing failed 
+	 *    at any time, else DecEncErrorCode#NO_FAILURE. 
+	 */
+        DecEncErrorCode finish()
+        {
+            if (!oStream_.isOpen())
+                return STREAM_OPENW_FAILED;
+            oStream_.append(buffer_);
+            buffer_.clear();
+            if (oStream_.bad())
+                return STREAM_WRITE_FAILED;
+            oStream_.close();
+            return NO_FAILURE;
+        }
+    }; // class IniWriter
+
+    inline DecEncErrorCode findValue(const std::string &path,
+                                     std::string_view section,
+                                     std::string_view key,
+                                     std::string &value,
+                                     char fieldSep,
+                                     char comment)
+    {
+        // only provides the grammar 
+        IniFile grammar(std::vector<unsigned int>(), fieldSep, comment);
+#ifdef SSTREAM_PREVENTED
+        IniFile::InFileStreamNS ifs(path);
+#else
+        std::ifstream is(path.c_str());
+        IniFile::InFileStream ifs(is);
+#endif
+        return grammar.tryFindValue(ifs, section, key, value);
+    }
 }
 
 #endif
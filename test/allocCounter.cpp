@@ -0,0 +1,155 @@
+/*
+ * allocCounter.cpp
+ *
+ * Created on: 19 Oct 2026
+ *    License: MIT
+ */
+
+#include "allocCounter.h"
+
+#include <atomic>
+#include <new>
+#include <stdlib.h>
+
+namespace
+{
+    std::atomic<std::size_t> numAllocs(0);
+
+    void count()
+    {
+        numAllocs.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+#ifdef __GLIBC__
+// With glibc malloc and friends can be replaced as well,
+// forwarding to the implementations of glibc.
+// Then operator new counts via malloc.
+extern "C"
+{
+    void *__libc_malloc(size_t size);
+    void *__libc_calloc(size_t num, size_t size);
+    void *__libc_realloc(void *ptr, size_t size);
+    void __libc_free(void *ptr);
+
+    void *malloc(size_t size)
+    {
+        count();
+        return __libc_malloc(size);
+    }
+
+    void *calloc(size_t num, size_t size)
+    {
+        count();
+        return __libc_calloc(num, size);
+    }
+
+    void *realloc(void *ptr, size_t size)
+    {
+        count();
+        return __libc_realloc(ptr, size);
+    }
+
+    void free(void *ptr)
+    {
+        __libc_free(ptr);
+    }
+}
+#define COUNT_NEW()
+#else
+#define COUNT_NEW() count()
+#endif
+
+namespace ini
+{
+namespace test
+{
+    std::size_t numAllocations()
+    {
+        return numAllocs.load(std::memory_order_relaxed);
+    }
+}
+}
+
+void *operator new(std::size_t size)
+{
+    COUNT_NEW();
+    void *ptr = malloc(size == 0 ? 1 : size);
+    if (ptr == NULL)
+        throw std::bad_alloc();
+    return ptr;
+}
+
+void *operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept
+{
+    COUNT_NEW();
+    return malloc(size == 0 ? 1 : size);
+}
+
+void *operator new[](std::size_t size, const std::nothrow_t &tag) noexcept
+{
+    return operator new(size, tag);
+}
+
+void *operator new(std::size_t size, std::align_val_t align)
+{
+    // aligned_alloc is not replaced above
+    count();
+    std::size_t alignment = static_cast<std::size_t>(align);
+    // aligned_alloc requires a multiple of the alignment
+    size = (size + alignment - 1) / alignment * alignment;
+    void *ptr = aligned_alloc(alignment, size == 0 ? alignment : size);
+    if (ptr == NULL)
+        throw std::bad_alloc();
+    return ptr;
+}
+
+void *operator new[](std::size_t size, std::align_val_t align)
+{
+    return operator new(size, align);
+}
+
+void operator delete(void *ptr) noexcept
+{
+    free(ptr);
+}
+
+void operator delete[](void *ptr) noexcept
+{
+    free(ptr);
+}
+
+void operator delete(void *ptr, std::size_t) noexcept
+{
+    free(ptr);
+}
+
+void operator delete[](void *ptr, std::size_t) noexcept
+{
+    free(ptr);
+}
+
+void operator delete(void *ptr, std::align_val_t) noexcept
+{
+    free(ptr);
+}
+
+void operator delete[](void *ptr, std::align_val_t) noexcept
+{
+    free(ptr);
+}
+
+void operator delete(void *ptr, std::size_t, std::align_val_t) noexcept
+{
+    free(ptr);
+}
+
+void operator delete[](void *ptr, std::size_t, std::align_val_t) noexcept
+{
+    free(ptr);
+}
@@ -0,0 +1,32 @@
+/*
+ * allocCounter.h
+ *
+ * Created on: 19 Oct 2026
+ *    License: MIT
+ *
+ * Counts heap allocations of the whole program
+ * by replacing the global operator new
+ * and with glibc also malloc, calloc and realloc.
+ * Link allocCounter.cpp into the executable to activate it.
+ */
+
+#ifndef ALLOC_COUNTER_H_
+#define ALLOC_COUNTER_H_
+
+#include <cstddef>
+
+namespace ini
+{
+namespace test
+{
+    /**
+     * Returns the number of allocations since program start,
+     * by any thread.
+     * Take the difference of two calls to count the allocations in between;
+     * note that REQUIRE and the like may allocate themselves.
+     */
+    std::size_t numAllocations();
+}
+}
+
+#endif
@@ -9,8 +9,17 @@
 //#include <catch.hpp>
 // TBD: tests whether throws prevented or not. 
 #include "inicpp.h"
+#include "allocCounter.h"
 #include <iostream>
 
+// the header is compiled with the switches of the first inclusion only 
+#ifndef INICPP_TEST_HEADER_SWITCHES
+#define INICPP_TEST_HEADER_SWITCHES
+#ifdef SSTREAM_PREVENTED
+#define INICPP_TEST_HEADER_SSTREAM_PREVENTED
+#endif
+#endif
+
 #ifdef SSTREAM_PREVENTED
 #define SS "SSY"
 #else
@@ -1464,6 +1473,1820 @@ INIF
 }
 
 
+/***************************************************
+ * Extracting several fields at once 
+ ***************************************************/
+
+
+TEST_CASE(TH " " SS " extract fields in one pass", "IniFile")
+{
+    std::string str("[Foo]\n"
+		    "bar1=42\n"
+		    "bar2=hello\n"
+		    "bar3=yes\n"
+		    "[Baz]\n"
+		    "bax0=1.5\n");
+    std::vector<unsigned int> mult = {3u, 1u};
+    ini::IniFile inif(mult);
+    INIF
+
+    int bar1, missing;
+    std::string bar2;
+    bool bar3;
+    double bax0, alsoBax0;
+    unsigned int noSection;
+    ini::ExtractResult result = inif.extract({
+	    ini::extractItem("Foo", "bar1",    bar1,      0),
+	    ini::extractItem("Foo", "missing", missing,   -1),
+	    ini::extractItem("Foo", "bar2",    bar2,      std::string()),
+	    ini::extractItem("Foo", "bar3",    bar3,      true),
+	    ini::extractItem("Baz", "bax0",    bax0,      0.0),
+	    ini::extractItem("Bar", "bax0",    noSection, 7u),
+	    ini::extractItem("Baz", "bax0",    alsoBax0,  0.0)});
+
+    REQUIRE(!result.isOk());
+    REQUIRE(result.getFailures().size() == 3);
+    REQUIRE(result.getFailures()[0].index == 1);
+    REQUIRE(result.getFailures()[0].errorCode
+	    == ini::DecEncErrorCode::FIELD_NOT_FOUND);
+    REQUIRE(result.getFailures()[1].index == 3);
+    REQUIRE(result.getFailures()[1].errorCode
+	    == ini::DecEncErrorCode::FIELD_CONVERSION_FAILED);
+    REQUIRE(result.getFailures()[2].index == 5);
+    REQUIRE(result.getFailures()[2].errorCode
+	    == ini::DecEncErrorCode::FIELD_NOT_FOUND);
+
+    REQUIRE(bar1 == 42);
+    REQUIRE(missing == -1);
+    REQUIRE(bar2 == "hello");
+    REQUIRE(bar3);
+    REQUIRE(bax0 == 1.5);
+    REQUIRE(noSection == 7u);
+    REQUIRE(alsoBax0 == 1.5);
+
+    // nothing inserted 
+    REQUIRE(inif.size() == 2);
+    REQUIRE(inif["Foo"].size() == 3);
+
+    result = inif.extract({ini::extractItem("Foo", "bar1", bar1, 0)});
+    REQUIRE(result.isOk());
+}
+
+/***************************************************
+ * Decoding into bound structs 
+ ***************************************************/
+
+
+TEST_CASE(TH " " SS " decode ini string into bound struct", "IniFile")
+{
+    struct Config
+    {
+        std::string host;
+        unsigned int port = 80u;
+        bool tls = false;
+        double ratio = 0.5;
+        std::string level = "info";
+        int rotate = -1;
+
+        static constexpr auto iniSchema()
+        {
+            return ini::bindSchema(
+                ini::bindSection("server",
+                    ini::bindField("host",  &Config::host),
+                    ini::bindField("port",  &Config::port),
+                    ini::bindField("tls",   &Config::tls),
+                    ini::bindField("ratio", &Config::ratio)),
+                ini::bindSection("logging",
+                    ini::bindField("level",  &Config::level),
+                    ini::bindField("rotate", &Config::rotate)));
+        }
+    };
+
+    std::string str("[logging]\n"
+		    "# a comment\n"
+		    "rotate = 7\n"
+		    "[server]\n"
+		    "host = example.org\n"
+		    "tls = TRUE\n"
+		    "port = 8080\n");
+    std::vector<unsigned int> mult = {};
+    ini::IniFile inif(mult);
+    Config config;
+#ifdef THROW_PREVENTED
+    ini::IniFile::DecEncResult deResult = inif.tryDecode(str, config);
+    REQUIRE(deResult.getErrorCode()
+	    == ini::DecEncErrorCode::NO_FAILURE);
+#else
+    inif.decode(str, config);
+#endif
+
+    // no sections are built 
+    REQUIRE(inif.size() == 0);
+    REQUIRE(config.host == "example.org");
+    REQUIRE(config.port == 8080u);
+    REQUIRE(config.tls);
+    // fields not occurring are left unchanged 
+    REQUIRE(config.ratio == 0.5);
+    REQUIRE(config.level == "info");
+    REQUIRE(config.rotate == 7);
+}
+
+TEST_CASE(TH " " SS " fail to decode ini string into bound struct", "IniFile")
+{
+    struct Config
+    {
+        int number = 0;
+        std::string name;
+
+        static constexpr auto iniSchema()
+        {
+            return ini::bindSchema(ini::bindSection("Foo",
+                ini::bindField("number", &Config::number),
+                ini::bindField("name",   &Config::name)));
+        }
+    };
+
+    std::vector<unsigned int> mult = {};
+    ini::IniFile inif(mult);
+    Config config;
+    ini::IniFile::DecEncResult deResult;
+
+    deResult = inif.tryDecode(std::string("[Foo]\n"
+					  "number=2x"), config);
+    REQUIRE(deResult.getErrorCode()
+	    == ini::DecEncErrorCode::FIELD_CONVERSION_FAILED);
+    REQUIRE(deResult.getLineNumber() == 2);
+    REQUIRE(config.number == 0);
+
+    deResult = inif.tryDecode(std::string("[Foo]\n"
+					  "name=bar\n"
+					  "unknown=1"), config);
+    REQUIRE(deResult.getErrorCode()
+	    == ini::DecEncErrorCode::FIELD_UNEXPECTED_IN_SECTION);
+    REQUIRE(deResult.getLineNumber() == 3);
+    REQUIRE(config.name == "bar");
+
+    deResult = inif.tryDecode(std::string("[Foo]\n"
+					  "name=bar\n"
+					  "name=baz"), config);
+    REQUIRE(deResult.getErrorCode()
+	    == ini::DecEncErrorCode::FIELD_NOT_UNIQUE_IN_SECTION);
+    REQUIRE(deResult.getLineNumber() == 3);
+
+    deResult = inif.tryDecode(std::string("[Foo]\n"
+					  "[Bar]"), config);
+    REQUIRE(deResult.getErrorCode()
+	    == ini::DecEncErrorCode::SECTION_UNEXPECTED);
+    REQUIRE(deResult.getLineNumber() == 2);
+
+    deResult = inif.tryDecode(std::string("[Foo]\n"
+					  "[Foo]"), config);
+    REQUIRE(deResult.getErrorCode()
+	    == ini::DecEncErrorCode::SECTION_NOT_UNIQUE);
+    REQUIRE(deResult.getLineNumber() == 2);
+
+#ifndef THROW_PREVENTED
+    REQUIRE_THROWS_AS(inif.decode(std::string("[Foo]\nnumber=x"), config),
+		      std::logic_error);
+#endif
+}
+
+
+/***************************************************
+ * Decoding at compile time 
+ ***************************************************/
+
+
+TEST_CASE(TH " " SS " decode ini string at compile time", "IniFile")
+{
+    static constexpr auto defaults = ini::parseStatic([] {
+	return "[server]\n"
+	       "  host = example.org\n"
+	       "port=0x1F90\n"
+	       "# a comment\n"
+	       "tls=tRuE\n"
+	       "\n"
+	       "[logging]\n"
+	       "level=info\n"
+	       "rotate=-7\n"
+	       "[empty]"; });
+
+    static_assert(defaults.size() == 3);
+    static_assert(defaults.numFields() == 5);
+    static_assert(defaults.contains("empty"));
+    static_assert(!defaults.contains("Server"));
+    static_assert(defaults.value("server", "host") == "example.org");
+    static_assert(defaults.get("server", "port", 0) == 8080);
+    static_assert(defaults.get("server", "tls", false));
+    static_assert(defaults.get("logging", "rotate", 0l) == -7l);
+    // conversion fails 
+    static_assert(defaults.get("logging", "rotate", 3u) == 3u);
+    static_assert(defaults.get("logging", "level", 5) == 5);
+    // field does not exist 
+    static_assert(defaults.find("logging", "host") == NULL);
+    static_assert(defaults.find("server", "level") == NULL);
+    static_assert(defaults.get("empty", "port", 42) == 42);
+
+    // also at runtime 
+    std::string section = "server";
+    REQUIRE(defaults.value(section, "host") == "example.org");
+    REQUIRE(defaults.find(section, "rotate") == NULL);
+
+    constexpr auto custom = ini::parseStatic<':', ';'>([] {
+	return "[Foo]\n"
+	       "; comment\n"
+	       "bar:=1\n"; });
+    static_assert(custom.value("Foo", "bar") == "=1");
+}
+
+#ifdef DEC_ENC_STATISTICS_ENABLED
+TEST_CASE(TH " " SS " statistics of decode and encode", "IniFile")
+{
+    std::string str("# head\n"
+		    "[Foo]\n"
+		    "bar=hello world\r\n"
+		    "  # indented comment\n"
+		    "\n"
+		    "[Test]\n"
+		    "x = 1\n"
+		    "yy=22");
+    std::vector<unsigned int> mult = {1u, 2u};
+    ini::IniFile inif(mult);
+    ini::IniFile::DecEncResult res = inif.tryDecode(str);
+    REQUIRE(res.isOk());
+    const ini::DecEncStatistics &decStats = res.getStatistics();
+    REQUIRE(decStats.getNumLines() == 8);
+    REQUIRE(decStats.getNumBytes() == str.size() + 1);
+    REQUIRE(decStats.getNumSections() == 2);
+    REQUIRE(decStats.getNumFields() == 3);
+    REQUIRE(decStats.getNumComments() == 2);
+    REQUIRE(decStats.getMaxLineLength() == 20);
+    REQUIRE(decStats.getIoTime().count() >= 0);
+    REQUIRE(decStats.getScanTime().count() >= 0);
+    REQUIRE(decStats.getInsertTime().count() >= 0);
+
+    // statistics up to the failure 
+    res = inif.tryDecode("[Foo]\nbar=1\nbar=2\nlost=3\n");
+    REQUIRE(res.getErrorCode() == ini::FIELD_NOT_UNIQUE_IN_SECTION);
+    REQUIRE(res.getStatistics().getNumLines() == 3);
+    REQUIRE(res.getStatistics().getNumFields() == 2);
+
+    std::string out;
+    inif["Foo"]["bar"] = "hello";
+    inif["Test"]["x"] = 1;
+    res = inif.tryEncode(out);
+    REQUIRE(res.isOk());
+    const ini::DecEncStatistics &encStats = res.getStatistics();
+    REQUIRE(encStats.getNumLines() == 4);
+    REQUIRE(encStats.getNumBytes() == out.size());
+    REQUIRE(encStats.getNumSections() == 2);
+    REQUIRE(encStats.getNumFields() == 2);
+    REQUIRE(encStats.getNumComments() == 0);
+    REQUIRE(encStats.getMaxLineLength() == 9);
+    REQUIRE(encStats.getInsertTime().count() == 0);
+}
+#endif
+TEST_CASE(TH " " SS " load ini file including files", "IniFile")
+{
+    const std::string fName = TESTFILE("include/tenant.ini");
+    std::vector<unsigned int> mult = {2u, 1u, 1u};
+    ini::IniFile inif(mult);
+
+    // by default no directive 
+    ini::IniFile::DecEncResult res = inif.tryLoad(fName);
+    REQUIRE(res.getErrorCode() == ini::ILLEGAL_LINE);
+    REQUIRE(res.getLineNumber() == 2);
+
+    inif.setIncludeDirective("!include");
+    ini::IniFile::clearIncludeCache();
+    res = inif.tryLoad(fName);
+    REQUIRE(res.isOk());
+    REQUIRE(inif.size() == 3);
+    REQUIRE(inif["Server"]["host"].toString() == "example.org");
+    // included from base/base.ini relative to base/ 
+    REQUIRE(inif["Server"]["port"].toString() == "8080");
+    REQUIRE(inif["Logging"]["level"].toString() == "info");
+    REQUIRE(inif["Tenant"]["name"].toString() == "acme");
+#ifdef DEC_ENC_STATISTICS_ENABLED
+    REQUIRE(res.getStatistics().getNumLines() == 4 + 6 + 2);
+    REQUIRE(res.getStatistics().getNumFields() == 4);
+#endif
+
+    // included files are read only once 
+    ini::IniFile inif2(mult);
+    inif2.setIncludeDirective("!include");
+    res = inif2.tryLoad(fName);
+    REQUIRE(res.isOk());
+    REQUIRE(inif2["Server"]["port"].toString() == "8080");
+#ifdef DEC_ENC_STATISTICS_ENABLED
+    REQUIRE(res.getStatistics().getNumLines() == 4);
+    REQUIRE(res.getStatistics().getNumFields() == 4);
+#endif
+
+    // also from a string relative to the current directory 
+    std::string str("!include " + TESTFILE("include/base/base.ini") + "\n"
+		    "[Tenant]\n");
+    std::vector<unsigned int> mult3 = {2u, 1u, 0u};
+    ini::IniFile inif3(mult3);
+    inif3.setIncludeDirective("!include");
+    res = inif3.tryDecode(str);
+    REQUIRE(res.isOk());
+    REQUIRE(inif3["Server"]["port"].toString() == "8080");
+}
+
+TEST_CASE(TH " " SS " fail to load ini file including files", "IniFile")
+{
+    std::vector<unsigned int> mult = {1u, 1u};
+    ini::IniFile inif(mult);
+    inif.setIncludeDirective("!include");
+
+    ini::IniFile::DecEncResult res =
+	inif.tryLoad(TESTFILE("include/cycleA.ini"));
+    REQUIRE(res.getErrorCode() == ini::INCLUDE_CYCLIC);
+    // in the included file 
+    REQUIRE(res.getLineNumber() == 2);
+
+    res = inif.tryLoad(TESTFILE("include/missing.ini"));
+    REQUIRE(res.getErrorCode() == ini::STREAM_OPENR_FAILED);
+    REQUIRE(res.getLineNumber() == 3);
+
+    res = inif.tryLoad(TESTFILE("include/broken.ini"));
+    REQUIRE(res.getErrorCode() == ini::SECTION_NOT_CLOSED);
+    REQUIRE(res.getLineNumber() == 3);
+
+    std::string str("[A]\n!include\n");
+    res = inif.tryDecode(str);
+    REQUIRE(res.getErrorCode() == ini::ILLEGAL_LINE);
+    REQUIRE(res.getLineNumber() == 2);
+#ifndef THROW_PREVENTED
+    REQUIRE_THROWS_AS(inif.load(TESTFILE("include/cycleA.ini")),
+		      std::logic_error);
+#endif
+}
+
+TEST_CASE(TH " " SS " reread included file after change", "IniFile")
+{
+    const std::string incName = (std::filesystem::temp_directory_path()
+				 / ("inicpp_included_" TH "_" SS ".ini")).string();
+    std::vector<unsigned int> mult = {1u};
+    ini::IniFile inif(mult);
+    inif.setIncludeDirective("!include");
+    std::string str("[A]\n!include " + incName + "\n");
+
+    FILE *file = fopen(incName.c_str(), "w");
+    REQUIRE(file != NULL);
+    fprintf(file, "x=1\n");
+    REQUIRE(fclose(file) == 0);
+    ini::IniFile::DecEncResult res = inif.tryDecode(str);
+    REQUIRE(res.isOk());
+    REQUIRE(inif["A"]["x"].toString() == "1");
+
+    // changes the size 
+    file = fopen(incName.c_str(), "w");
+    REQUIRE(file != NULL);
+    fprintf(file, "x=22\n");
+    REQUIRE(fclose(file) == 0);
+    res = inif.tryDecode(str);
+    REQUIRE(res.isOk());
+    REQUIRE(inif["A"]["x"].toString() == "22");
+    remove(incName.c_str());
+}
+
+TEST_CASE(TH " " SS " load ini file from cache", "IniFile")
+{
+    const std::filesystem::path dir = std::filesystem::temp_directory_path()
+	/ ("inicpp_loadCache_" TH "_" SS);
+    std::filesystem::create_directories(dir);
+    const std::string nameA = (dir / "a.ini").string();
+    const std::string nameB = (dir / "b.ini").string();
+    const std::string nameInc = (dir / "inc.ini").string();
+    auto write = [](const std::string &name, const char *content)
+    {
+	FILE *file = fopen(name.c_str(), "w");
+	REQUIRE(file != NULL);
+	fputs(content, file);
+	REQUIRE(fclose(file) == 0);
+    };
+    write(nameA, "[A]\nx=1\n");
+    write(nameB, "[B]\ny=2\n");
+
+    std::vector<unsigned int> mult = {1u};
+    ini::IniFile inif(mult);
+    std::shared_ptr<const ini::IniFile> doc1;
+    std::shared_ptr<const ini::IniFile> doc2;
+
+    // disabled by default 
+    REQUIRE(inif.tryLoadShared(nameA, doc1).isOk());
+    REQUIRE(inif.tryLoadShared(nameA, doc2).isOk());
+    REQUIRE(doc1 != nullptr);
+    REQUIRE(doc1 != doc2);
+
+    ini::IniFile::setLoadCacheCapacity(12);
+    REQUIRE(inif.tryLoadShared(nameA, doc1).isOk());
+    ini::IniFile::DecEncResult res = inif.tryLoadShared(nameA, doc2);
+    REQUIRE(res.isOk());
+    REQUIRE(doc1 == doc2);
+#ifdef DEC_ENC_STATISTICS_ENABLED
+    // not decoded again 
+    REQUIRE(res.getStatistics().getNumLines() == 0);
+#endif
+    res = inif.tryLoad(nameA);
+    REQUIRE(res.isOk());
+    REQUIRE(inif["A"]["x"].toString() == "1");
+
+    // the same file by another path 
+    REQUIRE(inif.tryLoadShared((dir / "." / "a.ini").string(), doc2).isOk());
+    REQUIRE(doc1 == doc2);
+
+    // another grammar 
+    std::vector<unsigned int> mult2 = {2u};
+    ini::IniFile inif2(mult2);
+    REQUIRE(inif2.tryLoadShared(nameA, doc2).isOk());
+    REQUIRE(doc1 != doc2);
+
+    // another large value threshold 
+    ini::IniFile inif3(mult);
+    inif3.setLargeValueThreshold(1);
+    REQUIRE(inif3.tryLoadShared(nameA, doc2).isOk());
+    REQUIRE(doc1 != doc2);
+
+    // changes the size 
+    write(nameA, "[A]\nx=22\n");
+    REQUIRE(inif.tryLoadShared(nameA, doc1).isOk());
+    REQUIRE(doc1 != doc2);
+    res = inif.tryLoad(nameA);
+    REQUIRE(res.isOk());
+    REQUIRE(inif["A"]["x"].toString() == "22");
+
+    // b.ini evicts a.ini as both exceed the capacity 
+    REQUIRE(inif.tryLoadShared(nameB, doc2).isOk());
+    REQUIRE(inif.tryLoadShared(nameA, doc2).isOk());
+    REQUIRE(doc1 != doc2);
+
+    res = inif.tryLoadShared((dir / "missing.ini").string(), doc2);
+    REQUIRE(res.getErrorCode() == ini::STREAM_OPENR_FAILED);
+    REQUIRE(doc2 == nullptr);
+
+    // the part before a failure is kept like without cache 
+    write(nameB, "[B]\ny=2\ngarbage\n");
+    res = inif.tryLoad(nameB);
+    REQUIRE(res.getErrorCode() == ini::ILLEGAL_LINE);
+    REQUIRE(res.getLineNumber() == 3);
+    REQUIRE(inif["B"]["y"].toString() == "2");
+
+    // a change in an included file is detected 
+    ini::IniFile::setLoadCacheCapacity(1024);
+    write(nameB, ("[B]\n!include " + nameInc + "\n").c_str());
+    write(nameInc, "y=1\n");
+    inif.setIncludeDirective("!include");
+    REQUIRE(inif.tryLoadShared(nameB, doc1).isOk());
+    REQUIRE(inif.tryLoadShared(nameB, doc2).isOk());
+    REQUIRE(doc1 == doc2);
+    write(nameInc, "y=22\n");
+    REQUIRE(inif.tryLoad(nameB).isOk());
+    REQUIRE(inif["B"]["y"].toString() == "22");
+
+#ifndef THREADS_PREVENTED
+    // threads loading the same file at a time share a single load 
+    write(nameA, "[A]\nx=333\n");
+    std::vector<std::shared_ptr<const ini::IniFile> > docs(4);
+    std::vector<std::thread> threads;
+    for (std::size_t idx = 0; idx < docs.size(); idx++)
+        threads.emplace_back([&docs, &nameA, &mult, idx]()
+			     {
+			         ini::IniFile own(mult);
+				 own.tryLoadShared(nameA, docs[idx]);
+			     });
+    for (std::thread &thread : threads)
+        thread.join();
+    for (const std::shared_ptr<const ini::IniFile> &doc : docs)
+    {
+        REQUIRE(doc != nullptr);
+        REQUIRE(doc == docs[0]);
+    }
+    REQUIRE((*docs[0]).find("A", "x")->toString() == "333");
+#endif
+
+    ini::IniFile::setLoadCacheCapacity(0);
+    std::filesystem::remove_all(dir);
+}
+
+TEST_CASE(TH " " SS " load ini file lazily", "IniFile")
+{
+    const std::string fName = (std::filesystem::temp_directory_path()
+			       / ("inicpp_lazy_" TH "_" SS ".ini")).string();
+    auto write = [&fName](const char *content)
+    {
+	FILE *file = fopen(fName.c_str(), "w");
+	REQUIRE(file != NULL);
+	fputs(content, file);
+	REQUIRE(fclose(file) == 0);
+    };
+    write("# head\n"
+	  "[A]\n"
+	  "a=1\n"
+	  "b = 2\r\n"
+	  "\n"
+	  "[B]\n"
+	  "c=3\n"
+	  "[C]\n"
+	  "d=4\n"
+	  "d=5\n");
+
+    std::vector<unsigned int> mult = {2u, 1u, 2u};
+    ini::IniFile inif(mult);
+    inif.setLazy(true);
+    ini::IniFile::DecEncResult res = inif.tryLoad(fName);
+    REQUIRE(res.isOk());
+    REQUIRE(inif.size() == 3);
+#ifdef DEC_ENC_STATISTICS_ENABLED
+    REQUIRE(res.getStatistics().getNumSections() == 3);
+    REQUIRE(res.getStatistics().getNumFields() == 0);
+#endif
+    REQUIRE(inif["B"]["c"].toString() == "3");
+    REQUIRE(inif["B"].size() == 1);
+    REQUIRE(inif["A"]["b"].toString() == "2");
+    // the failure in C shows up on access or validation only 
+    REQUIRE(inif["C"].size() == 1);
+    res = inif.tryValidate();
+    REQUIRE(res.getErrorCode() == ini::FIELD_NOT_UNIQUE_IN_SECTION);
+    REQUIRE(res.getLineNumber() == 10);
+#ifndef THROW_PREVENTED
+    REQUIRE_THROWS_AS(inif.validate(), std::logic_error);
+#endif
+
+    // encodes like an eagerly loaded file 
+    write("[A]\n"
+	  "a=1\n"
+	  "[B]\n"
+	  "c=3\n"
+	  "[C]\n"
+	  "d=4\n");
+    res = inif.tryLoad(fName);
+    REQUIRE(res.isOk());
+    REQUIRE(inif.tryValidate().isOk());
+    ini::IniFile eager(mult);
+    REQUIRE(eager.tryLoad(fName).isOk());
+    std::string lazyText;
+    std::string eagerText;
+    inif.tryLoad(fName);
+    REQUIRE(inif.tryEncode(lazyText).isOk());
+    REQUIRE(eager.tryEncode(eagerText).isOk());
+    REQUIRE(lazyText == eagerText);
+    // sections added after loading 
+    inif["D"]["e"] = 5;
+    REQUIRE(inif.size() == 4);
+    REQUIRE(inif["D"]["e"].toString() == "5");
+
+    // grammar failures in a section are reported like eagerly 
+    write("[A]\n"
+	  "x=1\n"
+	  "this is garbage\n"
+	  "y=2\n"
+	  "[B]\n"
+	  "z=3\n");
+    res = eager.tryLoad(fName);
+    REQUIRE(res.getErrorCode() == ini::ILLEGAL_LINE);
+    REQUIRE(res.getLineNumber() == 3);
+    REQUIRE(inif.tryLoad(fName).isOk());
+    REQUIRE(inif["A"]["x"].toString() == "1");
+    REQUIRE(inif.find("A", "y") == NULL);
+    res = inif.tryValidate();
+    REQUIRE(res.getErrorCode() == ini::ILLEGAL_LINE);
+    REQUIRE(res.getLineNumber() == 3);
+
+#ifndef THREADS_PREVENTED
+    // const methods may run concurrently after a lazy load 
+    write("[A]\n"
+	  "a=1\n"
+	  "[B]\n"
+	  "c=3\n"
+	  "[C]\n"
+	  "d=4\n");
+    REQUIRE(inif.tryLoad(fName).isOk());
+    const ini::IniFile &constInif = inif;
+    std::vector<int> numFound(4, 0);
+    std::vector<std::thread> threads;
+    for (std::size_t idx = 0; idx < numFound.size(); idx++)
+	threads.emplace_back([&constInif, &numFound, idx]()
+			     {
+				 for (const char *sec : {"C", "B", "A"})
+				     numFound[idx] +=
+					 constInif.find(sec, "a") != NULL
+					 || constInif.find(sec, "c") != NULL
+					 || constInif.find(sec, "d") != NULL;
+			     });
+    for (std::thread &thread : threads)
+	thread.join();
+    for (int num : numFound)
+	REQUIRE(num == 3);
+#endif
+
+    // sections are checked on loading 
+    write("[A]\n"
+	  "a=1\n"
+	  "[A]\n");
+    res = inif.tryLoad(fName);
+    REQUIRE(res.getErrorCode() == ini::SECTION_NOT_UNIQUE);
+    REQUIRE(res.getLineNumber() == 3);
+    write("a=1\n"
+	  "[A]\n");
+    res = inif.tryLoad(fName);
+    REQUIRE(res.getErrorCode() == ini::FIELD_WITHOUT_SECTION);
+    REQUIRE(res.getLineNumber() == 1);
+    write("[A]\n[B]\n[C]\n[D]\n");
+    res = inif.tryLoad(fName);
+    REQUIRE(res.getErrorCode() == ini::SECTION_UNEXPECTED);
+    REQUIRE(res.getLineNumber() == 4);
+    remove(fName.c_str());
+}
+
+TEST_CASE(TH " " SS " load selected sections only", "IniFile")
+{
+    const std::string fName = (std::filesystem::temp_directory_path()
+			       / ("inicpp_filter_" TH "_" SS ".ini")).string();
+    auto write = [&fName](const char *content)
+    {
+	FILE *file = fopen(fName.c_str(), "w");
+	REQUIRE(file != NULL);
+	fputs(content, file);
+	REQUIRE(fclose(file) == 0);
+    };
+    write("[logging]\n"
+	  "level=info\n"
+	  "[big]\n"
+	  "x=1\n"
+	  "x=1\n"
+	  "not checked\n"
+	  "[metrics]\n"
+	  "port=9000\n");
+
+    std::vector<unsigned int> mult = {1u, 0u, 1u};
+    ini::IniFile inif(mult);
+    ini::IniFile::DecEncResult res = inif.tryLoad(fName, {"logging", "metrics"});
+    REQUIRE(res.isOk());
+    REQUIRE(inif.size() == 2);
+    REQUIRE(inif["logging"]["level"].toString() == "info");
+    REQUIRE(inif["metrics"]["port"].toString() == "9000");
+
+    res = inif.tryLoad(fName, ini::SectionFilter([](std::string_view name)
+						 {
+						     return name == "metrics";
+						 }));
+    REQUIRE(res.isOk());
+    REQUIRE(inif.size() == 1);
+    REQUIRE(inif["metrics"]["port"].toString() == "9000");
+
+    // combined with lazy decoding 
+    inif.setLazy(true);
+    res = inif.tryLoad(fName, {"metrics"});
+    REQUIRE(res.isOk());
+    REQUIRE(inif.size() == 1);
+    REQUIRE(inif["metrics"]["port"].toString() == "9000");
+    REQUIRE(inif.tryValidate().isOk());
+    inif.setLazy(false);
+
+    // all sections are counted 
+    std::vector<unsigned int> mult2 = {1u, 0u};
+    ini::IniFile inif2(mult2);
+    res = inif2.tryLoad(fName, {"logging"});
+    REQUIRE(res.getErrorCode() == ini::SECTION_UNEXPECTED);
+    REQUIRE(res.getLineNumber() == 7);
+
+    // fields of selected sections are checked 
+    write("[logging]\n"
+	  "level=info\n"
+	  "[big]\n"
+	  "x=1\n"
+	  "[metrics]\n"
+	  "port=9000\n"
+	  "port=9001\n");
+    res = inif.tryLoad(fName, {"metrics"});
+    REQUIRE(res.getErrorCode() == ini::FIELD_NOT_UNIQUE_IN_SECTION);
+    REQUIRE(res.getLineNumber() == 7);
+    res = inif.tryLoad(fName, {"big"});
+    REQUIRE(res.getErrorCode() == ini::FIELD_UNEXPECTED_IN_SECTION);
+    REQUIRE(res.getLineNumber() == 4);
+
+    // decoding all lines with an include directive set 
+    inif.setIncludeDirective("!include");
+    ini::SectionFilter filter({"logging"});
+    res = inif.tryLoad(fName, filter);
+    REQUIRE(res.isOk());
+    REQUIRE(inif.size() == 1);
+    REQUIRE(inif["logging"]["level"].toString() == "info");
+
+    // skipped sections are checked for uniqueness with and without directive 
+    write("[keep]\n"
+	  "a=1\n"
+	  "[skip]\n"
+	  "x=1\n"
+	  "[skip]\n"
+	  "y=2\n");
+    std::vector<unsigned int> mult3 = {1u, 1u, 1u};
+    ini::IniFile inif3(mult3);
+    res = inif3.tryLoad(fName, {"keep"});
+    REQUIRE(res.getErrorCode() == ini::SECTION_NOT_UNIQUE);
+    REQUIRE(res.getLineNumber() == 5);
+    inif3.setIncludeDirective("!include");
+    res = inif3.tryLoad(fName, {"keep"});
+    REQUIRE(res.getErrorCode() == ini::SECTION_NOT_UNIQUE);
+    REQUIRE(res.getLineNumber() == 5);
+    remove(fName.c_str());
+}
+
+TEST_CASE(TH " " SS " find single value in file", "IniFile")
+{
+    std::string value;
+    REQUIRE(ini::findValue(TESTFILE("exampleNl.ini"), "Bar", "bar0", value)
+	    == ini::NO_FAILURE);
+    REQUIRE(value == "0");
+    REQUIRE(ini::findValue(TESTFILE("exampleNl.ini"), "Foo", "foo1", value)
+	    == ini::NO_FAILURE);
+    REQUIRE(value == "44");
+    REQUIRE(ini::findValue(TESTFILE("exampleNl.ini"), "Foo", "bar0", value)
+	    == ini::FIELD_NOT_FOUND);
+    REQUIRE(ini::findValue(TESTFILE("exampleNl.ini"), "Baz", "bar0", value)
+	    == ini::FIELD_NOT_FOUND);
+    REQUIRE(ini::findValue(TESTFILE("missing.ini"), "Bar", "bar0", value)
+	    == ini::STREAM_OPENR_FAILED);
+
+    const std::string fName = (std::filesystem::temp_directory_path()
+			       / ("inicpp_find_" TH "_" SS ".ini")).string();
+    FILE *file = fopen(fName.c_str(), "w");
+    REQUIRE(file != NULL);
+    fputs("; other grammar\n"
+	  "[A]\n"
+	  "not decoded\n"
+	  "[B]\n"
+	  " key : value \r\n"
+	  "[C\n", file);
+    REQUIRE(fclose(file) == 0);
+    // trimmed like by tryDecode and stops before the broken section 
+    REQUIRE(ini::findValue(fName, "B", "key", value, ':', ';')
+	    == ini::NO_FAILURE);
+    REQUIRE(value == "value");
+    REQUIRE(ini::findValue(fName, "B", "other", value, ':', ';')
+	    == ini::SECTION_NOT_CLOSED);
+    REQUIRE(ini::findValue(fName, "B", "key", value)
+	    == ini::ILLEGAL_LINE);
+    remove(fName.c_str());
+}
+
+TEST_CASE(TH " " SS " write ini file field by field", "IniFile")
+{
+    std::string content;
+    ini::IniFile::OutStringBuffer buffer(content, 0);
+    ini::IniWriter writer(buffer);
+    REQUIRE(writer.field("early", 1) == ini::FIELD_WITHOUT_SECTION);
+    REQUIRE(writer.beginSection("") == ini::SECTION_NAME_EMPTY);
+    REQUIRE(writer.beginSection("Foo") == ini::NO_FAILURE);
+    REQUIRE(writer.field("str", "text") == ini::NO_FAILURE);
+    REQUIRE(writer.field("int", -5) == ini::NO_FAILURE);
+    REQUIRE(writer.field("bool", true) == ini::NO_FAILURE);
+    REQUIRE(writer.beginSection("Bar") == ini::NO_FAILURE);
+    REQUIRE(writer.field("double", 1.5) == ini::NO_FAILURE);
+    REQUIRE(writer.field("string", std::string("x")) == ini::NO_FAILURE);
+    // buffered 
+    REQUIRE(content.empty());
+    REQUIRE(writer.finish() == ini::NO_FAILURE);
+
+    // as if encoded 
+    std::vector<unsigned int> mult = {3u, 2u};
+    ini::IniFile inif(mult);
+    inif["Foo"]["str"] = "text";
+    inif["Foo"]["int"] = -5;
+    inif["Foo"]["bool"] = true;
+    inif["Bar"]["double"] = 1.5;
+    inif["Bar"]["string"] = std::string("x");
+    std::string encoded;
+    REQUIRE(inif.tryEncode(encoded).isOk());
+    REQUIRE(content == encoded);
+
+    // uniqueness only if checked 
+    content.clear();
+    ini::IniWriter unchecked(buffer);
+    REQUIRE(unchecked.beginSection("A") == ini::NO_FAILURE);
+    REQUIRE(unchecked.field("a", 1) == ini::NO_FAILURE);
+    REQUIRE(unchecked.field("a", 1) == ini::NO_FAILURE);
+    REQUIRE(unchecked.beginSection("A") == ini::NO_FAILURE);
+    ini::IniWriter checked(buffer, ':', true);
+    REQUIRE(checked.beginSection("A") == ini::NO_FAILURE);
+    REQUIRE(checked.field("a", 1) == ini::NO_FAILURE);
+    REQUIRE(checked.field("a", 2) == ini::FIELD_NOT_UNIQUE_IN_SECTION);
+    REQUIRE(checked.beginSection("B") == ini::NO_FAILURE);
+    REQUIRE(checked.field("a", 3) == ini::NO_FAILURE);
+    REQUIRE(checked.beginSection("A") == ini::SECTION_NOT_UNIQUE);
+    REQUIRE(checked.finish() == ini::NO_FAILURE);
+    REQUIRE(content == "[A]\na:1\n[B]\na:3\n");
+
+    // many fields into a file flushing the buffer several times 
+    const std::string fName = (std::filesystem::temp_directory_path()
+			       / ("inicpp_writer_" TH "_" SS ".ini")).string();
+    {
+#ifdef INICPP_TEST_HEADER_SSTREAM_PREVENTED
+	ini::IniFile::OutFileStreamNS ofs(fName);
+#else
+	std::ofstream os(fName.c_str());
+	ini::IniFile::OutFileStream ofs(os);
+#endif
+	ini::IniWriter fileWriter(ofs);
+	REQUIRE(fileWriter.beginSection("Many") == ini::NO_FAILURE);
+	for (unsigned int idx = 0; idx < 20000; idx++)
+	    REQUIRE(fileWriter.field("k" + std::to_string(idx), idx)
+		    == ini::NO_FAILURE);
+	REQUIRE(fileWriter.finish() == ini::NO_FAILURE);
+    }
+    std::string value;
+    REQUIRE(ini::findValue(fName, "Many", "k19999", value) == ini::NO_FAILURE);
+    REQUIRE(value == "19999");
+    remove(fName.c_str());
+}
+
+TEST_CASE(TH " " SS " decode from custom sources", "IniFile")
+{
+    static_assert(ini::t_IsLineSource<ini::IniFile::InStringViewStream>::value);
+    static_assert(ini::t_IsLineSource<ini::IniFile::InStreamInterface>::value);
+    static_assert(!ini::t_IsLineSource<std::string>::value);
+
+    // decoded via the virtual interface 
+    class LinesSource : public ini::IniFile::InStreamInterface
+    {
+    private:
+	std::vector<std::string> lines_;
+	std::size_t idx_;
+    public:
+	LinesSource(std::vector<std::string> lines) : lines_(lines), idx_(0)
+	{}
+	bool isOpen()
+	{
+	    return true;
+	}
+	bool getLine(std::string &line)
+	{
+	    if (idx_ == lines_.size())
+		return false;
+	    line = lines_[idx_++];
+	    return true;
+	}
+	bool bad()
+	{
+	    return false;
+	}
+	int close()
+	{
+	    return 0;
+	}
+    };
+
+    std::vector<unsigned int> mult = {2u};
+    ini::IniFile inif(mult);
+    LinesSource source({"[Foo]", "a = 1", "# comment", "b=2"});
+    ini::IniFile::DecEncResult res = inif.tryDecode(source);
+    REQUIRE(res.isOk());
+    REQUIRE(inif["Foo"]["a"].toString() == "1");
+    REQUIRE(inif["Foo"]["b"].toString() == "2");
+
+    LinesSource broken({"[Foo]", "a"});
+    res = inif.tryDecode(broken);
+    REQUIRE(res.getErrorCode() == ini::ILLEGAL_LINE);
+    REQUIRE(res.getLineNumber() == 2);
+}
+
+TEST_CASE(TH " " SS " decode and encode static dialects", "IniFile")
+{
+    typedef ini::t_IniFile<ini::t_StaticDialect<':', ';', false> > ColonIniFile;
+    std::vector<unsigned int> mult = {2u};
+    ColonIniFile inif(mult);
+    ColonIniFile::DecEncResult res = inif.tryDecode("; comment\n"
+						    "[A]\n"
+						    " key : value \n"
+						    "cr:1\r\n");
+    REQUIRE(res.isOk());
+    REQUIRE(inif["A"]["key"].toString() == "value");
+    // no \r\n line endings 
+    REQUIRE(inif["A"]["cr"].toString() == "1\r");
+    std::string content;
+    REQUIRE(inif.tryEncode(content).isOk());
+    REQUIRE(content == "[A]\nkey:value\ncr:1\r\n");
+
+    res = inif.tryDecode("[A]\nkey=value\n");
+    REQUIRE(res.getErrorCode() == ini::ILLEGAL_LINE);
+    REQUIRE(res.getLineNumber() == 2);
+
+    // only blanks are trimmed 
+    typedef ini::t_IniFile<ini::t_StaticDialect<'=', '#', true, ' '> >
+	BlankIniFile;
+    BlankIniFile inif2(mult);
+    REQUIRE(inif2.tryDecode("[A]\n key\t= value\r\n").isOk());
+    REQUIRE(inif2["A"]["key\t"].toString() == "value");
+
+    static_assert(ini::t_BlankTable<ini::RuntimeDialect>::trim(" \tx\t ") == "x");
+    static_assert(ini::t_BlankTable<ini::t_StaticDialect<'=', '#', true, '_'> >
+		  ::trim("__x _") == "x ");
+}
+
+TEST_CASE(TH " " SS " load many ini files concurrently", "IniFile")
+{
+    std::vector<std::string> fileNames;
+    std::vector<ini::IniFile> iniFiles;
+    std::vector<unsigned int> mult = {2u, 1u};
+    std::vector<unsigned int> multTenant = {2u, 1u, 1u};
+    for (int idx = 0; idx < 10; idx++)
+    {
+	fileNames.push_back(TESTFILE("exampleNl.ini"));
+	iniFiles.push_back(ini::IniFile(mult));
+	fileNames.push_back(TESTFILE("doesNotExist.ini"));
+	iniFiles.push_back(ini::IniFile(mult));
+	fileNames.push_back(TESTFILE("include/tenant.ini"));
+	iniFiles.push_back(ini::IniFile(multTenant));
+	iniFiles.back().setIncludeDirective("!include");
+	fileNames.push_back(TESTFILE("include/broken.ini"));
+	iniFiles.push_back(ini::IniFile(mult));
+	iniFiles.back().setIncludeDirective("!include");
+    }
+
+    for (unsigned int numThreads : {1u, 3u, 0u})
+    {
+	std::vector<ini::IniFile::DecEncResult> results =
+	    ini::IniFile::loadAll(iniFiles, fileNames, numThreads, 2u);
+	REQUIRE(results.size() == fileNames.size());
+	for (std::size_t idx = 0; idx < fileNames.size(); idx += 4)
+	{
+	    REQUIRE(results[idx].isOk());
+	    REQUIRE(iniFiles[idx]["Foo"]["foo1"].toString() == "44");
+	    REQUIRE(results[idx + 1].getErrorCode() == ini::STREAM_OPENR_FAILED);
+	    REQUIRE(results[idx + 2].isOk());
+	    REQUIRE(iniFiles[idx + 2]["Server"]["port"].toString() == "8080");
+	    REQUIRE(results[idx + 3].getErrorCode() == ini::SECTION_NOT_CLOSED);
+	    REQUIRE(results[idx + 3].getLineNumber() == 3);
+	}
+    }
+
+    std::vector<ini::IniFile> noFiles;
+    REQUIRE(ini::IniFile::loadAll(noFiles, std::vector<std::string>()).empty());
+
+    // file names without IniFile fail 
+    std::vector<ini::IniFile> fewFiles(1, ini::IniFile(mult));
+    std::vector<ini::IniFile::DecEncResult> results =
+	ini::IniFile::loadAll(fewFiles, fileNames);
+    REQUIRE(results.size() == fileNames.size());
+    REQUIRE(results[0].isOk());
+    REQUIRE(results[1].getErrorCode() == ini::INI_FILE_MISSING);
+    REQUIRE(results.back().getErrorCode() == ini::INI_FILE_MISSING);
+    results = ini::IniFile::saveAll(noFiles, fileNames);
+    REQUIRE(results.size() == fileNames.size());
+    REQUIRE(results[0].getErrorCode() == ini::INI_FILE_MISSING);
+
+    // the large value threshold of each IniFile is respected 
+    std::vector<ini::IniFile> largeFiles(2, ini::IniFile(mult));
+    largeFiles[1].setLargeValueThreshold(1);
+    results = ini::IniFile::loadAll(largeFiles,
+				    {TESTFILE("exampleNl.ini"),
+				     TESTFILE("exampleNl.ini")});
+    REQUIRE(results[0].isOk());
+    REQUIRE(results[1].isOk());
+    REQUIRE(!largeFiles[0]["Foo"]["foo1"].isExternal());
+    REQUIRE(largeFiles[1]["Foo"]["foo1"].isExternal());
+    REQUIRE(largeFiles[1]["Foo"]["foo1"].toString() == "44");
+}
+
+TEST_CASE(TH " " SS " save and load many ini files", "IniFile")
+{
+    const std::filesystem::path dir = std::filesystem::temp_directory_path()
+	/ ("inicpp_saveAll_" TH "_" SS);
+    std::filesystem::create_directories(dir);
+    std::vector<std::string> fileNames;
+    std::vector<ini::IniFile> iniFiles;
+    std::vector<unsigned int> mult = {1u};
+    // more than one batch of IoUring 
+    for (int idx = 0; idx < 300; idx++)
+    {
+	fileNames.push_back((dir / ("file" + std::to_string(idx) + ".ini")).string());
+	iniFiles.push_back(ini::IniFile(mult));
+	iniFiles.back()["Sec"]["idx"] = idx;
+	iniFiles.back()["Sec"]["text"] = std::string(idx*10, 'x');
+    }
+    // not writable 
+    fileNames[7] = dir.string();
+
+    std::vector<ini::IniFile::DecEncResult> results =
+	ini::IniFile::saveAll(iniFiles, fileNames);
+    REQUIRE(results.size() == fileNames.size());
+    for (std::size_t idx = 0; idx < fileNames.size(); idx++)
+    {
+	if (idx == 7)
+	    REQUIRE(!results[idx].isOk());
+	else
+	    REQUIRE(results[idx].isOk());
+    }
+
+    std::vector<unsigned int> mult2 = {2u};
+    std::vector<ini::IniFile> loaded(fileNames.size(), ini::IniFile(mult2));
+    results = ini::IniFile::loadAll(loaded, fileNames, 2u);
+    for (std::size_t idx = 0; idx < fileNames.size(); idx++)
+    {
+	if (idx == 7)
+	{
+	    REQUIRE(results[idx].getErrorCode() == ini::STREAM_READ_FAILED);
+	    continue;
+	}
+	REQUIRE(results[idx].isOk());
+	REQUIRE(loaded[idx]["Sec"]["idx"].toString() == std::to_string(idx));
+	REQUIRE(loaded[idx]["Sec"]["text"].toString().length() == idx*10);
+    }
+    std::filesystem::remove_all(dir);
+}
+
+#ifdef IO_URING_ENABLED
+TEST_CASE(TH " " SS " read and write files via io_uring", "IniFile")
+{
+    ini::IoUring ring;
+    if (!ring.isOpen())
+    {
+	WARN("io_uring not provided by the kernel");
+	return;
+    }
+    const std::filesystem::path dir = std::filesystem::temp_directory_path()
+	/ ("inicpp_io_uring_" TH "_" SS);
+    std::filesystem::create_directories(dir);
+    std::vector<std::string> fileNames;
+    std::vector<std::string> contents;
+    for (int idx = 0; idx < 200; idx++)
+    {
+	fileNames.push_back((dir / ("file" + std::to_string(idx))).string());
+	contents.push_back(std::string(idx*idx, (char)('a' + idx % 26)));
+    }
+    fileNames[3] = (dir / "noDir" / "file").string();
+    std::vector<ini::DecEncErrorCode> errorCodes;
+    REQUIRE(ring.writeFiles(fileNames, contents, errorCodes));
+    REQUIRE(errorCodes[3] == ini::STREAM_OPENW_FAILED);
+    errorCodes[3] = ini::NO_FAILURE;
+    REQUIRE(std::count(errorCodes.begin(), errorCodes.end(), ini::NO_FAILURE)
+	    == (long)fileNames.size());
+
+    std::vector<std::string> read;
+    std::vector<std::size_t> reread;
+    fileNames.push_back(dir.string());
+    REQUIRE(ring.readFiles(fileNames, read, errorCodes, reread));
+    REQUIRE(reread.empty());
+    REQUIRE(errorCodes[3] == ini::STREAM_OPENR_FAILED);
+    REQUIRE(errorCodes[200] == ini::STREAM_READ_FAILED);
+    for (std::size_t idx = 0; idx < 200; idx++)
+    {
+	if (idx != 3)
+	    REQUIRE(read[idx] == contents[idx]);
+    }
+    std::filesystem::remove_all(dir);
+}
+#endif
+
+
+/* Allocation counts by allocCounter.cpp: 
+ * the read path shall not allocate. 
+ */
+
+TEST_CASE(TH " " SS " lookups with string views do not allocate", "IniFile")
+{
+    std::string str("[Section with a long name]\n"
+		    "key with a long name=value with a long text\n"
+		    "[Foo]\n"
+		    "bar=1\n");
+    std::vector<unsigned int> mult = {1u, 1u};
+    ini::IniFile inif(mult);
+    INIF
+
+    const std::string sec("Section with a long name");
+    std::string_view key("key with a long name");
+    std::size_t length = 0;
+    std::size_t numAllocs = ini::test::numAllocations();
+    for (int idx = 0; idx < 100; idx++)
+    {
+	length += inif[sec][key].toString().length();
+	length += inif["Foo"]["bar"].toString().length();
+	length += inif.size() + inif[sec].map.contains(key);
+    }
+    numAllocs = ini::test::numAllocations() - numAllocs;
+    REQUIRE(numAllocs == 0);
+    REQUIRE(length == 100*(22 + 1 + 2 + 1));
+
+    // inserting allocates 
+    numAllocs = ini::test::numAllocations();
+    inif[sec]["another key with a long name"] = 1;
+    numAllocs = ini::test::numAllocations() - numAllocs;
+    REQUIRE(numAllocs > 0);
+}
+
+TEST_CASE(TH " " SS " const lookups do not insert", "IniFile")
+{
+    std::string str("[Section with a long name]\n"
+		    "key with a long name=42\n"
+		    "text=value with a long text\n"
+		    "[Foo]\n"
+		    "bar=no number\n");
+    std::vector<unsigned int> mult = {2u, 1u};
+    ini::IniFile inif(mult);
+    INIF
+    const ini::IniFile &cinif = inif;
+
+    const std::string sec("Section with a long name");
+    REQUIRE(cinif.find(sec) != NULL);
+    REQUIRE(cinif.find("no section") == NULL);
+    REQUIRE(cinif.find(sec, "key with a long name") != NULL);
+    REQUIRE(cinif.find(sec, "key with a long name")->toString() == "42");
+    REQUIRE(cinif.find(sec, "no key") == NULL);
+    REQUIRE(cinif.find("no section", "no key") == NULL);
+
+    std::size_t numAllocs = ini::test::numAllocations();
+    int sum = 0;
+    for (int idx = 0; idx < 100; idx++)
+    {
+        // hit, miss of key, miss of section and failed conversion 
+	sum += cinif.get(sec, "key with a long name", 0);
+	sum += cinif.get(sec, "another key with a long name", 1);
+	sum += cinif.get("another section with a long name", "bar", 2);
+	sum += cinif.get("Foo", "bar", 3);
+    }
+    numAllocs = ini::test::numAllocations() - numAllocs;
+    REQUIRE(numAllocs == 0);
+    REQUIRE(sum == 100*(42 + 1 + 2 + 3));
+    REQUIRE(cinif.get(sec, "text", std::string()) == "value with a long text");
+    REQUIRE(cinif.get("Foo", "bar", true) == true);
+    // the outcome is not recorded in the field 
+    REQUIRE(!cinif.find("Foo", "bar")->failedLastOutConversion());
+
+#ifndef THREADS_PREVENTED
+    // conversions of one field succeeding and failing concurrently 
+    std::vector<int> numWrong(4, 0);
+    std::vector<std::thread> threads;
+    for (std::size_t idx = 0; idx < numWrong.size(); idx++)
+	threads.emplace_back([&cinif, &sec, &numWrong, idx]()
+			     {
+				 for (int num = 0; num < 1000; num++)
+				     numWrong[idx] += idx % 2 == 0
+					 ? cinif.get(sec, "key with a long name", 0) != 42
+					 : cinif.get(sec, "key with a long name", true) != true;
+			     });
+    for (std::thread &thread : threads)
+	thread.join();
+    REQUIRE(numWrong == std::vector<int>(4, 0));
+#endif
+
+    // nothing was inserted 
+    REQUIRE(cinif.size() == 2);
+    REQUIRE(cinif.find(sec)->size() == 2);
+    REQUIRE(cinif.find("Foo")->size() == 1);
+}
+
+TEST_CASE(TH " " SS " access fields by resolved handles", "IniFile")
+{
+    std::string str("[Foo]\n"
+		    "bar=1\n"
+		    "baz=2\n"
+		    "[Test]\n"
+		    "key=3\n");
+    std::vector<unsigned int> mult = {2u, 1u, 1u};
+    ini::IniFile inif(mult);
+    INIF
+
+    ini::FieldHandle hBaz = inif.resolve("Foo", "baz");
+    ini::FieldHandle hKey = inif.resolve("Test", "key");
+    REQUIRE(hBaz.isResolved());
+    REQUIRE(hKey.isResolved());
+    REQUIRE(!inif.resolve("Foo", "no key").isResolved());
+    REQUIRE(!inif.resolve("no section", "bar").isResolved());
+    REQUIRE(inif.tryAt(ini::FieldHandle()) == NULL);
+
+    REQUIRE(inif.tryAt(hBaz) == &inif["Foo"]["baz"]);
+    REQUIRE(inif.tryAt(hBaz)->as<int>() == 2);
+    REQUIRE(inif.tryAt(hKey)->as<int>() == 3);
+    *inif.tryAt(hKey) = 4;
+    REQUIRE(inif["Test"]["key"].as<int>() == 4);
+
+    // appending keeps handles valid 
+    inif["Other"]["key"] = 5;
+    inif["Foo"]["new"] = 6;
+    REQUIRE(inif.tryAt(hBaz)->as<int>() == 2);
+    REQUIRE(inif.tryAt(hKey)->as<int>() == 4);
+    const ini::IniFile &cinif = inif;
+    REQUIRE(cinif.tryAt(hBaz)->as<int>() == 2);
+
+    // decoding again makes them stale 
+    REQUIRE(inif.tryDecode(str).isOk());
+    REQUIRE(inif.tryAt(hBaz) == NULL);
+    REQUIRE(inif.tryAt(hKey) == NULL);
+#ifndef THROW_PREVENTED
+    REQUIRE_THROWS_AS(inif.at(hBaz), std::out_of_range);
+#endif
+    hBaz = inif.resolve("Foo", "baz");
+    REQUIRE(inif.tryAt(hBaz)->as<int>() == 2);
+#ifndef THROW_PREVENTED
+    REQUIRE(inif.at(hBaz).as<int>() == 2);
+#endif
+
+    // handles are stale for copies, after assigning and for other files 
+    ini::IniFile other(mult);
+    REQUIRE(other.tryDecode(str).isOk());
+    REQUIRE(other.tryAt(hBaz) == NULL);
+    ini::IniFile copy(inif);
+    REQUIRE(copy.tryAt(hBaz) == NULL);
+    ini::FieldHandle hOther = other.resolve("Foo", "baz");
+    REQUIRE(inif.tryAt(hOther) == NULL);
+    inif = other;
+    REQUIRE(inif.tryAt(hBaz) == NULL);
+    REQUIRE(inif.tryAt(hOther) == NULL);
+    REQUIRE(other.tryAt(hOther)->as<int>() == 2);
+}
+
+TEST_CASE(TH " " SS " references stay valid when inserting", "IniFile")
+{
+    std::string str("[Foo]\n"
+		    "bar=1\n");
+    std::vector<unsigned int> mult = {1u};
+    ini::IniFile inif(mult);
+    INIF
+
+    // beyond the storage reserved by decoding 
+    ini::IniSection &foo = inif["Foo"];
+    ini::IniField &bar = foo["bar"];
+    std::vector<ini::IniField *> fields;
+    for (int idx = 0; idx < 1000; idx++)
+    {
+        ini::IniSection &sec = inif["Section" + std::to_string(idx)];
+	fields.push_back(&sec["key"]);
+	*fields.back() = idx;
+	foo["key" + std::to_string(idx)] = idx;
+    }
+    REQUIRE(&foo == &inif["Foo"]);
+    REQUIRE(&bar == &inif["Foo"]["bar"]);
+    REQUIRE(bar.as<int>() == 1);
+    for (int idx = 0; idx < 1000; idx++)
+    {
+        REQUIRE(fields[idx] == &inif["Section" + std::to_string(idx)]["key"]);
+	REQUIRE(fields[idx]->as<int>() == idx);
+	REQUIRE(foo["key" + std::to_string(idx)].as<int>() == idx);
+    }
+    REQUIRE(inif.size() == 1001);
+    REQUIRE(foo.size() == 1001);
+
+    // iterating keeps the order of insertion 
+    int idx = -1;
+    for (const auto &pair : foo.map)
+    {
+        REQUIRE(pair.first == (idx < 0 ? "bar" : "key" + std::to_string(idx)));
+	idx++;
+    }
+    REQUIRE(idx == 1000);
+    REQUIRE((foo.map.end() - 1)->first == "key999");
+    REQUIRE(foo.map.end() - foo.map.begin() == 1001);
+
+    // copies are independent 
+    ini::IniSection copy = foo;
+    copy["bar"] = 2;
+    REQUIRE(bar.as<int>() == 1);
+    REQUIRE(copy.size() == 1001);
+    REQUIRE(copy["key500"].as<int>() == 500);
+    ini::IniSection moved = std::move(copy);
+    REQUIRE(moved["bar"].as<int>() == 2);
+    REQUIRE(moved.size() == 1001);
+}
+
+TEST_CASE(TH " " SS " iterate over views of sections and fields", "IniFile")
+{
+    std::string str("[Section with a long name]\n"
+		    "key with a long name=value with a long text\n"
+		    "number=42\n"
+		    "[Foo]\n"
+		    "bar=another value with a long text\n");
+    std::vector<unsigned int> mult = {2u, 1u};
+    ini::IniFile inif(mult);
+    INIF
+    const ini::IniFile &cinif = inif;
+    static_assert(noexcept(std::declval<const ini::IniField &>().view()), "view shall not throw");
+    static_assert(noexcept(std::declval<const ini::IniField &>().str()), "str shall not throw");
+
+    std::size_t length = 0;
+    std::string joined;
+    joined.reserve(1000);
+    std::size_t numAllocs = ini::test::numAllocations();
+    for (ini::SectionView sec : cinif.sections())
+    {
+        joined.append(sec.name).append(":");
+	for (auto [key, value] : sec.section.fields())
+	{
+	    joined.append(key).append("=").append(value).append(";");
+	    length += value.length();
+	}
+    }
+    numAllocs = ini::test::numAllocations() - numAllocs;
+    REQUIRE(numAllocs == 0);
+    REQUIRE(joined == "Section with a long name:"
+	    "key with a long name=value with a long text;number=42;"
+	    "Foo:bar=another value with a long text;");
+    REQUIRE(length == 23 + 2 + 29);
+    REQUIRE(cinif.sections().size() == 2);
+    REQUIRE(cinif.find("Foo")->fields().size() == 1);
+
+    // views refer to the fields 
+    const ini::IniField &bar = *cinif.find("Foo", "bar");
+    REQUIRE(bar.view().data() == bar.str().data());
+    REQUIRE(&bar.str() == &bar.toString());
+    REQUIRE(bar.view() == "another value with a long text");
+
+    // numbers assigned are formatted for viewing 
+    inif["Foo"]["bar"] = 17;
+    REQUIRE(bar.view() == "17");
+    REQUIRE((*cinif.find("Foo")->fields().begin()).value == "17");
+}
+
+TEST_CASE(TH " " SS " split fields into lists of elements", "IniFile")
+{
+    std::string str("[Foo]\n"
+		    "backends=10.0.0.1:80, 10.0.0.2:80 ,10.0.0.3:80\n"
+		    "ints=1, -2,3 ,\t4\n"
+		    "doubles=1.5,-0.25,1e3\n"
+		    "bools=true,FALSE,True\n"
+		    "bad=1,2,x,4\n"
+		    "empty=\n");
+    std::vector<unsigned int> mult = {6u};
+    ini::IniFile inif(mult);
+    INIF
+    const ini::IniSection &sec = *static_cast<const ini::IniFile &>(inif)
+      .find("Foo");
+
+    std::vector<std::string_view> views;
+    ini::SplitResult res = sec.find("backends")->tryAsVector(views);
+    REQUIRE(res.isOk());
+    REQUIRE(res.numElements == 3);
+    REQUIRE(views == std::vector<std::string_view>
+	    ({"10.0.0.1:80", "10.0.0.2:80", "10.0.0.3:80"}));
+    REQUIRE(views[1].data() == sec.find("backends")->view().data() + 13);
+
+    std::vector<int> ints;
+    REQUIRE(sec.find("ints")->tryAsVector(ints).isOk());
+    REQUIRE(ints == std::vector<int>({1, -2, 3, 4}));
+    std::vector<unsigned int> uints;
+    res = sec.find("ints")->tryAsVector(uints);
+    REQUIRE(res.idxFailed == 1);
+    REQUIRE(uints == std::vector<unsigned int>({1u}));
+
+    std::vector<double> doubles;
+    REQUIRE(sec.find("doubles")->tryAsVector(doubles).isOk());
+    REQUIRE(doubles == std::vector<double>({1.5, -0.25, 1000.0}));
+    std::vector<bool> bools;
+    REQUIRE(sec.find("bools")->tryAsVector(bools).isOk());
+    REQUIRE(bools == std::vector<bool>({true, false, true}));
+
+    res = sec.find("bad")->tryAsVector(ints);
+    REQUIRE(!res.isOk());
+    REQUIRE(res.idxFailed == 2);
+    REQUIRE(res.numElements == 2);
+    REQUIRE(sec.find("empty")->tryAsVector(ints).isOk());
+    REQUIRE(ints.empty());
+
+    // other delimiters 
+    REQUIRE(sec.find("backends")->tryAsVector(views, ':').numElements == 4);
+    REQUIRE(views[1] == "80, 10.0.0.2");
+
+    // by cast 
+    REQUIRE(sec.find("ints")->orDefault(std::vector<int>()) ==
+	    std::vector<int>({1, -2, 3, 4}));
+    REQUIRE(sec.find("bad")->orDefault(std::vector<int>({7})) ==
+	    std::vector<int>({7}));
+    REQUIRE(sec.find("bad")->failedLastOutConversion());
+#ifndef THROW_PREVENTED
+    REQUIRE(sec.find("ints")->as<std::vector<long int>>().size() == 4);
+    REQUIRE_THROWS_AS(sec.find("bad")->as<std::vector<int>>(),
+		      std::invalid_argument);
+#endif
+
+    // a long list allocates once or not at all 
+    ini::IniField &numbers = inif["Foo"]["numbers"];
+    std::string list;
+    for (int idx = 0; idx < 10000; idx++)
+        list += (idx == 0 ? "" : ",") + std::to_string(idx);
+    numbers = list;
+    std::vector<int> values;
+    long sum = 0;
+    std::size_t numAllocs = ini::test::numAllocations();
+    res = numbers.forEachElement<int>(',', [&sum](int elem) { sum += elem; });
+    numAllocs = ini::test::numAllocations() - numAllocs;
+    REQUIRE(numAllocs == 0);
+    REQUIRE(res.numElements == 10000);
+    REQUIRE(sum == 9999l * 10000 / 2);
+
+    numAllocs = ini::test::numAllocations();
+    res = numbers.tryAsVector(values);
+    numAllocs = ini::test::numAllocations() - numAllocs;
+    REQUIRE(numAllocs == 1);
+    REQUIRE(res.isOk());
+    REQUIRE(values.size() == 10000);
+    REQUIRE(values[9999] == 9999);
+}
+
+TEST_CASE(TH " " SS " encode and decode blobs", "IniFile")
+{
+    std::vector<unsigned int> mult = {2u};
+    ini::IniFile inif(mult);
+    ini::IniField &field = inif["Blobs"]["blob"];
+
+    // RFC 4648 
+    const char *plain[] = {"", "f", "fo", "foo", "foob", "fooba", "foobar"};
+    const char *base64[] = {"", "Zg==", "Zm8=", "Zm9v", "Zm9vYg==", "Zm9vYmE=",
+			    "Zm9vYmFy"};
+    const char *hex[] = {"", "66", "666f", "666f6f", "666f6f62", "666f6f6261",
+			 "666f6f626172"};
+    for (std::size_t idx = 0; idx < 7; idx++)
+    {
+        ini::Base64Blob blob(std::vector<std::uint8_t>
+			     (plain[idx], plain[idx] + strlen(plain[idx])));
+	field = blob;
+	REQUIRE(field.toString() == base64[idx]);
+	REQUIRE(field.as<ini::Base64Blob>().bytes == blob.bytes);
+	field = ini::HexBlob(blob.bytes);
+	REQUIRE(field.toString() == hex[idx]);
+	REQUIRE(field.as<ini::HexBlob>().bytes == blob.bytes);
+    }
+    std::vector<std::uint8_t> bytes;
+    field = std::string("Zm9vYg");
+    REQUIRE(field.tryAsBytes(bytes, ini::BLOB_BASE64));
+    REQUIRE(std::string(bytes.begin(), bytes.end()) == "foob");
+    field = std::string("666F6F");
+    REQUIRE(field.tryAsBytes(bytes, ini::BLOB_HEX));
+    REQUIRE(std::string(bytes.begin(), bytes.end()) == "foo");
+
+    // malformed 
+    const char *badBase64[] = {"Z", "Zg=", "Z===", "Zg==Zg==", "Zm9v Zm9v"};
+    for (const char *text : badBase64)
+    {
+        field = text;
+	REQUIRE(!field.tryAsBytes(bytes, ini::BLOB_BASE64));
+	REQUIRE(field.orDefault(ini::Base64Blob()).bytes.empty());
+	REQUIRE(field.failedLastOutConversion());
+    }
+    field = "666";
+    REQUIRE(!field.tryAsBytes(bytes, ini::BLOB_HEX));
+    field = "66 6";
+    REQUIRE(!field.tryAsBytes(bytes, ini::BLOB_HEX));
+#ifndef THROW_PREVENTED
+    REQUIRE_THROWS_AS(field.as<ini::HexBlob>(), std::invalid_argument);
+#endif
+
+    // blocks done by vector instructions and the rest 
+    std::uint32_t state = 1;
+    for (std::size_t len : {15, 16, 17, 31, 47, 48, 49, 100, 1000, 100003})
+    {
+        std::vector<std::uint8_t> data(len);
+	for (std::uint8_t &byte : data)
+	{
+	    state ^= state << 13;
+	    state ^= state >> 17;
+	    state ^= state << 5;
+	    byte = (std::uint8_t)state;
+	}
+	for (ini::BlobEncoding enc : {ini::BLOB_HEX, ini::BLOB_BASE64})
+	{
+	    std::string scalar(ini::BlobCodec::encodedLength(enc, len), ' ');
+	    if (enc == ini::BLOB_HEX)
+	        ini::BlobCodec::encodeHexScalar(data.data(), len, &scalar[0]);
+	    else
+	        ini::BlobCodec::encodeBase64Scalar(data.data(), len, &scalar[0]);
+	    field.assignBytes(data.data(), len, enc);
+	    REQUIRE(field.toString() == scalar);
+	    bytes.clear();
+	    bytes.shrink_to_fit();
+	    std::size_t numAllocs = ini::test::numAllocations();
+	    REQUIRE(field.tryAsBytes(bytes, enc));
+	    numAllocs = ini::test::numAllocations() - numAllocs;
+	    REQUIRE(numAllocs == 1);
+	    REQUIRE(bytes == data);
+
+	    // an invalid character anywhere is found 
+	    for (std::size_t pos : {std::size_t(0), std::size_t(5),
+				    scalar.size() / 2, scalar.size() - 3})
+	    {
+	        for (char chr : {'!', '=', '\x80', 'g'})
+		{
+		    if (chr == 'g' && enc == ini::BLOB_BASE64)
+		        continue;
+		    std::string bad = scalar;
+		    bad[pos] = chr;
+		    field = bad;
+		    REQUIRE(!field.tryAsBytes(bytes, enc));
+		}
+	    }
+	}
+    }
+}
+
+TEST_CASE(TH " " SS " large values refer to the file loaded", "IniFile")
+{
+    const std::string fName = (std::filesystem::temp_directory_path()
+			       / ("inicpp_large_" TH "_" SS ".ini")).string();
+    const std::string large(100000, 'x');
+    const std::string base64 = "Zm9vYmFy";
+    {
+	FILE *file = fopen(fName.c_str(), "w");
+	REQUIRE(file != NULL);
+	fprintf(file, "# %s\n[A]\nsmall = 1\nlarge =  %s \r\n"
+		"[B]\nblob=%s\n", large.c_str(), large.c_str(),
+		(base64 + std::string(2000, 'A')).c_str());
+	REQUIRE(fclose(file) == 0);
+    }
+
+    std::vector<unsigned int> mult = {2u, 1u};
+    ini::IniFile inif(mult);
+    inif.setLargeValueThreshold(1000);
+    ini::IniFile::DecEncResult res = inif.tryLoad(fName);
+    REQUIRE(res.isOk());
+    REQUIRE(res.getLineNumber() == 7);
+    const ini::IniField &field = inif["A"]["large"];
+    REQUIRE(field.isExternal());
+    REQUIRE(!inif["A"]["small"].isExternal());
+    REQUIRE(inif["A"]["small"].as<int>() == 1);
+    REQUIRE(field.view() == large);
+    std::vector<std::uint8_t> bytes;
+    REQUIRE(inif["B"]["blob"].isExternal());
+    REQUIRE(inif["B"]["blob"].tryAsBytes(bytes, ini::BLOB_BASE64));
+    REQUIRE(bytes.size() == 1506);
+    REQUIRE(std::string(bytes.begin(), bytes.begin() + 6) == "foobar");
+
+    // read in chunks without copying 
+    ini::ValueReader reader = field.reader(30000);
+    REQUIRE(reader.size() == large.size());
+    std::string_view chunk;
+    std::size_t numChunks = 0;
+    std::size_t length = 0;
+    while (reader.next(chunk))
+    {
+	REQUIRE(chunk.data() == field.view().data() + length);
+	REQUIRE(chunk.find_first_not_of('x') == std::string_view::npos);
+	numChunks++;
+	length += chunk.size();
+	REQUIRE(reader.remaining() == large.size() - length);
+    }
+    REQUIRE(numChunks == 4);
+    REQUIRE(length == large.size());
+
+#ifndef THREADS_PREVENTED
+    // copied once also if read concurrently from a shared document 
+    {
+	std::shared_ptr<const ini::IniFile> doc;
+	REQUIRE(inif.tryLoadShared(fName, doc).isOk());
+	const ini::IniField *shared = doc->find("A", "large");
+	REQUIRE(shared != NULL);
+	REQUIRE(shared->isExternal());
+	std::vector<int> numEqual(4, 0);
+	std::vector<std::thread> threads;
+	for (std::size_t idx = 0; idx < numEqual.size(); idx++)
+	    threads.emplace_back([shared, &large, &numEqual, idx]()
+				 {
+				     numEqual[idx] += shared->toString() == large;
+				     numEqual[idx] += shared->str() == large;
+				 });
+	for (std::thread &thread : threads)
+	    thread.join();
+	REQUIRE(numEqual == std::vector<int>(4, 2));
+    }
+#endif
+
+    // saving replaces the file mapped instead of truncating it 
+    inif["A"]["small"] = 2;
+    REQUIRE(inif.trySave(fName).isOk());
+    REQUIRE(field.view() == large);
+    {
+	ini::IniFile saved(mult);
+	REQUIRE(saved.tryLoad(fName).isOk());
+	REQUIRE(saved["A"]["small"].as<int>() == 2);
+	REQUIRE(saved["A"]["large"].toString() == large);
+    }
+    std::vector<ini::IniFile> iniFiles = {inif};
+    std::vector<std::string> fNames = {fName};
+    std::vector<ini::IniFile::DecEncResult> results =
+	ini::IniFile::saveAll(iniFiles, fNames);
+    REQUIRE(results[0].isOk());
+    REQUIRE(field.view() == large);
+
+    // copied on demand, outliving the file 
+    ini::IniField copy = field;
+    std::filesystem::remove(fName);
+    inif["A"]["large"] = 3;
+    REQUIRE(!inif["A"]["large"].isExternal());
+    REQUIRE(copy.isExternal());
+    REQUIRE(copy.toString() == large);
+    REQUIRE(copy.view() == large);
+
+    // encodes like values copied 
+    std::string encoded;
+    REQUIRE(inif.tryEncode(encoded).isOk());
+    REQUIRE(encoded.find("blob=" + base64) != std::string::npos);
+
+    // fields without section are rejected also if large 
+    {
+	FILE *file = fopen(fName.c_str(), "w");
+	REQUIRE(file != NULL);
+	fprintf(file, "large=%s\n", large.c_str());
+	REQUIRE(fclose(file) == 0);
+    }
+    res = inif.tryLoad(fName);
+    REQUIRE(res.getErrorCode() == ini::FIELD_WITHOUT_SECTION);
+    REQUIRE(res.getLineNumber() == 1);
+    std::filesystem::remove(fName);
+}
+
+TEST_CASE(TH " " SS " repeated conversions do not allocate", "IniFile")
+{
+    std::string str("[Foo]\n"
+		    "int=-17\n"
+		    "uint=0x11\n"
+		    "double=1.5e300\n"
+		    "bool=TrUe\n"
+		    "text=not a bool and not a number either\n");
+    std::vector<unsigned int> mult = {5u};
+    ini::IniFile inif(mult);
+    INIF
+
+    ini::IniSection &sec = inif["Foo"];
+    long sum = 0;
+    double dsum = 0;
+    std::size_t numFailed = 0;
+    std::size_t numAllocs = ini::test::numAllocations();
+    for (int idx = 0; idx < 100; idx++)
+    {
+	sum += sec["int"].orDefault(0);
+	sum += sec["uint"].orDefault(0u);
+	sum += sec["int"].orDefault(0l);
+	sum += sec["uint"].orDefault(0ul);
+	dsum += sec["double"].orDefault(0.0);
+	dsum += sec["double"].orDefault(0.0f);
+	sum += sec["bool"].orDefault(false);
+	sum += strlen(sec["text"].orDefault((const char *)NULL));
+	// failing conversions do not allocate either 
+	sum += sec["text"].orDefault(true);
+	numFailed += sec["text"].failedLastOutConversion();
+	sum += sec["text"].orDefault(3);
+	numFailed += sec["text"].failedLastOutConversion();
+#ifndef THROW_PREVENTED
+	sum += sec["int"].as<int>();
+	sum += sec["bool"].as<bool>();
+#endif
+    }
+    numAllocs = ini::test::numAllocations() - numAllocs;
+    REQUIRE(numAllocs == 0);
+#ifdef THROW_PREVENTED
+    REQUIRE(sum == 100*(-17 + 17 - 17 + 17 + 1 + 34 + 1 + 3));
+#else
+    REQUIRE(sum == 100*(-17 + 17 - 17 + 17 + 1 + 34 + 1 + 3 - 17 + 1));
+#endif
+    REQUIRE(dsum > 1e300);
+    REQUIRE(numFailed == 200);
+}
+
+TEST_CASE(TH " " SS " numbers assigned are formatted on demand", "IniFile")
+{
+    ini::IniFile inif(std::vector<unsigned int>({3u}));
+    ini::IniField &counter = inif["Stats"]["counter"];
+    counter = 0;
+    std::size_t numAllocs = ini::test::numAllocations();
+    for (int idx = 0; idx < 1000; idx++)
+        counter = counter.as<int>() + 1;
+    numAllocs = ini::test::numAllocations() - numAllocs;
+    REQUIRE(numAllocs == 0);
+    REQUIRE(counter.toString() == "1000");
+    REQUIRE(counter.as<int>() == 1000);
+
+    // reading as another type goes via the text 
+    REQUIRE(counter.as<double>() == 1000.0);
+    REQUIRE(counter.as<unsigned long int>() == 1000ul);
+    REQUIRE(!counter.orDefault(false));
+    REQUIRE(counter.failedLastOutConversion());
+    counter = -5;
+    REQUIRE(counter.orDefault(7u) == 7u);
+    REQUIRE(counter.as<long int>() == -5l);
+
+    // same type reads back exactly, the text has 6 significant digits 
+    ini::IniField &ratio = inif["Stats"]["ratio"];
+    ratio = 0.1234567;
+    REQUIRE(ratio.as<double>() == 0.1234567);
+    REQUIRE(ratio.toString() == "0.123457");
+    REQUIRE(ratio.as<float>() == 0.123457f);
+    ratio = 0.25f;
+    REQUIRE(ratio.as<float>() == 0.25f);
+    REQUIRE(ratio.toString() == "0.25");
+
+    ini::IniField &flag = inif["Stats"]["flag"];
+    flag = true;
+    REQUIRE(flag.as<bool>());
+    REQUIRE(flag.toString() == "true");
+    flag = std::string("no bool");
+    REQUIRE(!flag.orDefault(false));
+    REQUIRE(flag.failedLastOutConversion());
+    flag = false;
+    REQUIRE(std::string(flag.as<const char *>()) == "false");
+
+    // copies keep the native value 
+    ini::IniField copy = counter;
+    REQUIRE(copy.as<int>() == -5);
+    REQUIRE(copy.toString() == "-5");
+
+    std::string str;
+    REQUIRE(inif.tryEncode(str).isOk());
+    REQUIRE(str == "[Stats]\n"
+	    "counter=-5\n"
+	    "ratio=0.25\n"
+	    "flag=false\n");
+}
+
+TEST_CASE(TH " " SS " encoding into a string allocates once", "IniFile")
+{
+    std::vector<unsigned int> mult = {2u, 1u};
+    ini::IniFile inif(mult);
+    inif["First section"]["first key"] = "a value longer than the small string buffer";
+    inif["First section"]["second key"] = 42;
+    inif["Second section"]["third key"] = true;
+#ifdef DEC_ENC_STATISTICS_ENABLED
+    ini::allocationCounter = &ini::test::numAllocations;
+#endif
+
+    std::string str;
+    std::size_t numAllocs = ini::test::numAllocations();
+    ini::IniFile::DecEncResult res = inif.tryEncode(str);
+    numAllocs = ini::test::numAllocations() - numAllocs;
+    REQUIRE(res.isOk());
+    REQUIRE(numAllocs == 1);
+    REQUIRE(str.length() == inif.lengthText());
+    REQUIRE(str == "[First section]\n"
+	    "first key=a value longer than the small string buffer\n"
+	    "second key=42\n"
+	    "[Second section]\n"
+	    "third key=true\n");
+#ifdef DEC_ENC_STATISTICS_ENABLED
+    // reserving precedes encoding 
+    REQUIRE(res.getStatistics().getNumAllocations() == 0);
+#endif
+
+    // capacity suffices already 
+    numAllocs = ini::test::numAllocations();
+    res = inif.tryEncode(str);
+    numAllocs = ini::test::numAllocations() - numAllocs;
+    REQUIRE(res.isOk());
+    REQUIRE(numAllocs == 0);
+#ifdef DEC_ENC_STATISTICS_ENABLED
+    ini::allocationCounter = NULL;
+#endif
+}
+
+
+TEST_CASE(TH " " SS " decode many sections and fields into reserved storage", "IniFile")
+{
+    static_assert(std::is_nothrow_move_constructible<ini::IniField>::value,
+		  "IniField shall move without throwing");
+    static_assert(std::is_nothrow_move_assignable<ini::IniField>::value,
+		  "IniField shall move without throwing");
+    static_assert(std::is_nothrow_move_constructible<ini::IniSection>::value,
+		  "IniSection shall move without throwing");
+
+    // beyond the limit of linear search for unique names 
+    const unsigned int numSecs = 40;
+    const unsigned int numFields = 30;
+    std::string str;
+    for (unsigned int idxSec = 0; idxSec < numSecs; idxSec++)
+    {
+        str += "[section" + std::to_string(idxSec) + "]\n";
+	for (unsigned int idxField = 0; idxField < numFields; idxField++)
+	    str += "key" + std::to_string(idxField) + "="
+	        + std::to_string(idxSec * numFields + idxField) + "\n";
+    }
+
+    ini::IniFile inif(std::vector<unsigned int>(numSecs, numFields));
+    ini::IniFile::DecEncResult res = inif.tryDecode(str);
+    REQUIRE(res.isOk());
+    REQUIRE(inif.size() == numSecs);
+    REQUIRE(inif["section0"]["key0"].as<int>() == 0);
+    REQUIRE(inif["section39"]["key29"].as<int>() == 1199);
+    REQUIRE(inif["section17"]["key21"].as<int>() == 17 * 30 + 21);
+    std::string strEnc;
+    REQUIRE(inif.tryEncode(strEnc).isOk());
+    REQUIRE(strEnc == str);
+
+    // duplicates are found by hashing 
+    std::string strDupKey = str;
+    strDupKey.replace(strDupKey.find("key25=25"), 8, "key24=25");
+    res = inif.tryDecode(strDupKey);
+    REQUIRE(res.getErrorCode() == ini::FIELD_NOT_UNIQUE_IN_SECTION);
+
+    std::string strDupSec = str;
+    strDupSec.replace(strDupSec.find("[section30]"), 11, "[section20]");
+    res = inif.tryDecode(strDupSec);
+    REQUIRE(res.getErrorCode() == ini::SECTION_NOT_UNIQUE);
+
+    // small sections are checked linearly 
+    ini::IniFile inifSmall(std::vector<unsigned int>({2u}));
+    res = inifSmall.tryDecode("[sec]\nkey=1\nkey=2\n");
+    REQUIRE(res.getErrorCode() == ini::FIELD_NOT_UNIQUE_IN_SECTION);
+}
+
+
 #undef SS
 #undef TH
 
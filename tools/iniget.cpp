@@ -0,0 +1,59 @@
+/*
+ * iniget.cpp
+ *
+ * Created on: 19 Oct 2026
+ *    License: MIT
+ *
+ * Prints the value of a single field of an ini-file
+ * using ini::findValue, i.e. reading the file only up to the field.
+ *
+ * Usage: iniget [--separator C] [--comment C] FILE SECTION KEY
+ *
+ * Exit status: 0 if the field is found, 1 if not
+ * and 2 if the file cannot be read or decoded or on wrong usage.
+ */
+
+#include "inicpp.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <string>
+
+int main(int argc, char **argv)
+{
+    char fieldSep = '=';
+    char comment = '#';
+    int idx = 1;
+    for (; idx + 1 < argc && strncmp(argv[idx], "--", 2) == 0; idx += 2)
+    {
+        if (strcmp(argv[idx], "--separator") == 0 && strlen(argv[idx + 1]) == 1)
+            fieldSep = argv[idx + 1][0];
+        else if (strcmp(argv[idx], "--comment") == 0 && strlen(argv[idx + 1]) == 1)
+            comment = argv[idx + 1][0];
+        else
+            break;
+    }
+    if (argc - idx != 3)
+    {
+        fprintf(stderr, "usage: %s [--separator C] [--comment C]"
+                " FILE SECTION KEY\n", argv[0]);
+        return 2;
+    }
+
+    std::string value;
+    ini::DecEncErrorCode errorCode =
+        ini::findValue(argv[idx], argv[idx + 1], argv[idx + 2], value,
+                       fieldSep, comment);
+    switch (errorCode)
+    {
+    case ini::NO_FAILURE:
+        printf("%s\n", value.c_str());
+        return 0;
+    case ini::FIELD_NOT_FOUND:
+        return 1;
+    default:
+        fprintf(stderr, "%s: failed to read %s with code %d\n",
+                argv[0], argv[idx], (int)errorCode);
+        return 2;
+    }
+}